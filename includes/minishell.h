@@ -13,6 +13,10 @@
 #ifndef MINISHELL_H
 # define MINISHELL_H
 
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
+
 # include "../libft/includes/libft.h"
 # include <stdio.h>
 # include <stdlib.h>
@@ -24,35 +28,97 @@
 # include <string.h>
 # include <termios.h>
 # include <fcntl.h>
+# include <spawn.h>
 # include <readline/readline.h>
 # include <readline/history.h>
 # include <sys/types.h>
 # include <sys/wait.h>
 # include <sys/stat.h>
+# include <sys/mman.h>
+# include <sys/uio.h>
+# include <sys/file.h>
+# include <sys/eventfd.h>
+# include <poll.h>
+# include <pthread.h>
+# include <stdatomic.h>
+# include <stdint.h>
+# include <time.h>
 # include <stdbool.h>
 
 extern volatile sig_atomic_t	g_signal_received;
 
 /*
+HISTORY_DIR - Directory of the history files, opened once at startup
+			  relative to the directory the shell started in.
 HISTORY_FILE - Stores the history from previous session
 			   and is loaded into memory on startup.
-HISTORY_FILE_TMP - Temporary file for copying history
-				   to prevent data loss.
-HISTORY_FILE_MAX - Maximum number of lines in history file.
-HIST_MEM_MAX - Maximum number of lines to load in memory using add_history.
+HISTORY_FILE_TMP - Temporary file a compaction writes before it is
+				   renamed over HISTORY_FILE.
+HISTORY_FILE_MAX - Default number of entries kept in the history file,
+				   overridden by HISTFILESIZE.
+HIST_COMPACT_INTERVAL - Lines a shell appends between two compactions.
+HIST_MEM_MAX - Default number of entries kept in memory, overridden by
+			   HISTSIZE.
 HIST_BUFFER_SZ - Buffer size for reading history file in bytes.
 HIST_LINE_SZ - Buffer size for reading each history line in bytes.
 */
 # define PROMPT "bleshell$> "
-# define HISTORY_FILE "temp/bleshell_history"
-# define HISTORY_FILE_TMP "temp/bleshell_history_tmp"
-# define TMP_BUF "temp/temp_buffer"
-# define HISTORY_FILE_MAX 100
-# define HIST_MEM_MAX 50
+# define HISTORY_DIR "temp"
+# define HISTORY_FILE "bleshell_history"
+# define HISTORY_FILE_TMP "bleshell_history_tmp"
+# define HD_STORE_NAME "bleshell_heredoc"
+# define HD_STORE_DIR "/tmp"
+# define HD_FLUSH_SZ 65536
+# define HISTORY_FILE_MAX 2000
+# define HIST_COMPACT_INTERVAL 64
+# define HIST_MEM_MAX 1000
 # define HIST_BUFFER_SZ 4096
 # define HIST_LINE_SZ 1024
-# define LPIPE 0
-# define RPIPE 1
+# define CMD_HASH_SIZE 64
+# define ENV_IDX_MIN 64
+# define ARGS_MIN_CAP 8
+
+/*
+History search index.
+HIST_TRI_BITS - log2 of the number of trigram posting lists.
+HIST_IDX_MIN - Initial capacity of entry arrays and posting lists.
+HIST_SEARCH_KEY - Readline key sequence bound to the indexed search.
+*/
+# define HIST_TRI_BITS 16
+# define HIST_IDX_MIN 16
+# define HIST_SEARCH_KEY "\\ep"
+
+/*
+Background history writer.
+HIST_QUEUE_SZ - Slots in the entry queue, a power of two.
+HIST_SYNC_MS - Delay before written entries are fsync()ed to disk.
+HIST_WAIT_US - Sleep between two checks when waiting on the writer.
+*/
+# define HIST_QUEUE_SZ 256
+# define HIST_SYNC_MS 1000
+# define HIST_WAIT_US 200
+
+/*
+Builtin output buffer.
+OUT_BUF_SZ - Bytes of builtin output held before a write to STDOUT,
+			 the default capacity of a Linux pipe.
+*/
+# define OUT_BUF_SZ 65536
+
+/*
+Per-command arena used for token and AST nodes and their argument
+and quote type arrays.
+ARENA_CHUNK_SZ - Minimum payload size of one arena chunk in bytes.
+ARENA_ALIGN - Alignment of every arena allocation.
+ARENA_POISON - Set to 1 (make debug) to fill reset arenas with
+			   ARENA_POISON_BYTE.
+*/
+# define ARENA_CHUNK_SZ 4096
+# define ARENA_ALIGN 16
+# define ARENA_POISON_BYTE 0xA5
+# ifndef ARENA_POISON
+#  define ARENA_POISON 0
+# endif
 
 /*
 String representations of token types.
@@ -65,6 +131,7 @@ This enables easy conversion between enum and string.
 # define TOKEN_TYPE_DOUBLE_QUOTE     "\""
 # define TOKEN_TYPE_SINGLE_QUOTE     "'"
 # define TOKEN_TYPE_HEREDOC          "<<"
+# define TOKEN_TYPE_HERESTRING       "<<<"
 # define TOKEN_TYPE_IN_REDIR      "<"
 # define TOKEN_TYPE_OUT_REDIR     ">"
 # define TOKEN_TYPE_APPD_REDIR  ">>"
@@ -94,6 +161,13 @@ Mode settings for the out_mode variable.
 # define OUT_MODE_TRUNCATE 1
 # define OUT_MODE_APPEND 2
 
+/*
+Actions of the shopt builtin.
+*/
+# define SHOPT_QUERY 0
+# define SHOPT_SET 1
+# define SHOPT_UNSET 2
+
 /*
 Error code settings.
 */
@@ -121,6 +195,7 @@ typedef enum e_tokentype
 	TYPE_EXPANSION = 10,
 	TYPE_PIPE = 11,
 	TYPE_EXIT_STATUS = 12,
+	TYPE_HERESTRING = 13,
 }	t_tokentype;
 
 /*
@@ -143,38 +218,188 @@ typedef struct s_envop
 	char			*export_key;
 	int				flag;
 	int				arg_len;
-	int				matched_idx;
 	struct s_envop	*next;
 }	t_envop;
 
+/*
+Entry of the command hash table.
+- name: command word as typed.
+- path: resolved path, or NULL when the command was not found.
+- hits: number of times the entry answered a lookup.
+*/
+typedef struct s_cmdhash
+{
+	char				*name;
+	char				*path;
+	int					hits;
+	struct s_cmdhash	*next;
+}	t_cmdhash;
+
+/*
+Callback run on each command of the history file.
+*/
+typedef void			(*t_histline_fn)(char *cmd, void *ctx);
+
+/*
+List of the history entries containing a trigram, in ascending order.
+Several trigrams can share a list, so matches are always verified.
+*/
+typedef struct s_postings
+{
+	int	*ids;
+	int	count;
+	int	cap;
+}	t_postings;
+
+/*
+In-memory search index over history entries.
+- entries: every distinct history line once, in order of first use.
+- seq: number of the add that last used each entry (for recency).
+- dedup: open addressing hash set of entry number + 1, dedup_cap slots.
+- tri: 1 << HIST_TRI_BITS trigram posting lists.
+- loaded: set once the history file has been indexed.
+- rs_query, rs_seq, rs_last: state of the readline search binding.
+*/
+typedef struct s_histidx
+{
+	char		**entries;
+	int			*seq;
+	int			count;
+	int			cap;
+	int			*dedup;
+	int			dedup_cap;
+	int			next_seq;
+	t_postings	*tri;
+	int			loaded;
+	char		*rs_query;
+	int			rs_seq;
+	int			rs_last;
+}	t_histidx;
+
+/*
+History entry handed to the writer thread.
+- data, len: formatted entry, freed by the writer.
+- keep: unless -1, compact the file to keep entries afterwards.
+*/
+typedef struct s_histmsg
+{
+	char	*data;
+	size_t	len;
+	int		keep;
+}	t_histmsg;
+
+/*
+Background history writer, fed by a single-producer single-consumer
+ring that needs no lock.
+- ring, head, tail: the shell pushes at head, the writer pops at tail.
+- done: value of tail once the popped entries were written.
+- efd: eventfd the shell signals after each push or on stop.
+- lock_fd: history file fd while the writer has it open, or -1.
+- dirty: written entries wait for the next fsync (writer only).
+- active: set in the shell process while the writer thread runs.
+*/
+typedef struct s_histwr
+{
+	t_histmsg		ring[HIST_QUEUE_SZ];
+	atomic_size_t	head;
+	atomic_size_t	tail;
+	atomic_size_t	done;
+	atomic_int		stop;
+	atomic_int		lock_fd;
+	int				efd;
+	int				dirty;
+	int				active;
+	pthread_t		thread;
+}	t_histwr;
+
+/*
+Chunk of arena memory, the payload follows the aligned header.
+- size: payload size in bytes.
+- used: bytes handed out from the payload so far.
+*/
+typedef struct s_arena_chunk
+{
+	struct s_arena_chunk	*next;
+	size_t					size;
+	size_t					used;
+}	t_arena_chunk;
+
+/*
+Bump allocator released as a whole with arena_reset().
+- head: first chunk, kept across resets.
+- curr: chunk currently being allocated from.
+*/
+typedef struct s_arena
+{
+	t_arena_chunk	*head;
+	t_arena_chunk	*curr;
+}	t_arena;
+
+/*
+Output buffer builtins write STDOUT through.
+- buf, len: bytes waiting for the next write.
+- err: a write failed, later output is dropped until the next flush.
+*/
+typedef struct s_outbuf
+{
+	char	buf[OUT_BUF_SZ];
+	size_t	len;
+	int		err;
+}	t_outbuf;
+
+/*
+Script read from memory, a file mapped by open_script() or the
+string given to -c by open_cmd_string().
+- map, len: the script contents.
+- pos: offset of the next unread line.
+- mapped: map must be munmap()ed.
+*/
+typedef struct s_script
+{
+	char	*map;
+	size_t	len;
+	size_t	pos;
+	int		mapped;
+}	t_script;
+
 /*
 Node structure for linked list and AST.
 Next and prev are for building linked list.
 Left and right are for building AST.
+args and arg_quote_type are NULL terminated vectors of arg_count
+entries with room for arg_cap pointers, terminator included.
+arena is the per-command arena the node, both vectors and the quote
+types of each argument are allocated from.
+hd_fd holds the gathered body of a heredoc or here-string node,
+hd_expand whether a heredoc body gets variable expansion.
 */
 typedef struct s_node
 {
 	t_tokentype		type;
 	char			**args;
 	int				**arg_quote_type;
+	int				arg_count;
+	int				arg_cap;
+	int				hd_fd;
+	int				hd_expand;
 	struct s_node	*next;
 	struct s_node	*prev;
 	struct s_node	*left;
 	struct s_node	*right;
 	struct s_node	*redir;
 	struct s_node	*next_redir;
+	t_arena			*arena;
 }	t_node;
 
 /*
 Structure for managing read buffer processing.
-Handles the variables needed for reading and processing.
-content from a temporary file.
+Handles the variables needed for splitting buffered multiline
+input into commands.
+- cmd: command being assembled from one or more lines.
 */
 typedef struct s_read_buf
 {
-	char			*file_content;
-	char			*buffer;
-	int				pos;
+	t_strbuf		cmd;
 	int				in_quotes;
 	char			quote_type;
 }	t_read_buf;
@@ -185,21 +410,24 @@ Has variables tracking:
 - Pipe structure
 - Execution resources
 - File descriptors
+- Pending heredoc output (hd_buf), written out with flush_hd_buf()
 - AST structure
 - Last command status
 */
 typedef struct s_pipe
 {
-	// int			pipe_count;
+	int			pipe_count;
 	pid_t		*pids;
 	int			saved_stdin;
 	int			saved_stdout;
 	int			hd_fd;
 	char		*heredoc_delim;
 	int			hd_expand;
+	t_strbuf	hd_buf;
 	int			redir_fd;
 	int			out_mode;
 	int			in_pipe;
+	int			exec_in_place;
 	t_node		*current_redirect;
 	t_node		*last_cmd;
 	t_node		*last_pipe;
@@ -240,12 +468,33 @@ typedef struct s_vars
 	int				pos;
 	int				start;
 	int				hd_text_ready;
+	char			*hd_src;
 	int				shell_level;
 	struct termios	ori_term_settings;
 	int				ori_term_saved;
+	int				interactive;
+	int				lastpipe;
+	int				in_bytewise;
+	int				in_peek[2];
+	t_reader		in_rd;
+	t_script		script;
+	char			**pos_args;
+	int				pos_count;
 	int				error_code;
 	int				empty_quote_flag;
 	t_pipe			*pipes;
+	t_cmdhash		*cmd_hash[CMD_HASH_SIZE];
+	int				*env_idx;
+	int				env_idx_cap;
+	int				env_len;
+	int				env_cap;
+	unsigned long	env_gen;
+	char			**envp;
+	unsigned long	envp_gen;
+	t_arena			arena;
+	t_histidx		hist_idx;
+	t_histwr		hist_wr;
+	t_outbuf		out;
 }	t_vars;
 
 /* Builtin commands functions.
@@ -258,7 +507,6 @@ In builtin_cd.c
 int			builtin_cd(char **args, t_vars *vars);
 int			handle_cd_special(char **args, t_vars *vars, char **path_value);
 int			handle_cd_path(char **args, t_vars *vars);
-int			export_env_var(t_vars *vars, char *key, char *value);
 int			update_env_pwd(t_vars *vars, char *oldpwd);
 
 /*
@@ -266,22 +514,14 @@ Builtin "echo" command. Outputs arguments to STDOUT.
 In builtin_echo.c
 */
 int			builtin_echo(char **args, t_vars *vars);
-int			process_echo_args(char **args, int start, int nl_flag);
+int			process_echo_args(t_outbuf *out, char **args, int start,
+				int nl_flag);
 
 /*
 Builtin "env" command. Outputs the environment variables.
 In builtin_env.c
 */
 int			builtin_env(t_vars *vars);
-/*
-Builtin environment operations calculation functions.
-In builtin_envops_calc.c
-*/
-int			decide_action_at_index(int idx, t_envop *env_list,
-				t_envop **overwrite_node);
-int			calc_new_env_len(t_envop *envop_list, int old_len);
-int			chk_copy_or_write(int idx, t_envop *envop_list,
-				t_envop **overwrite_node);
 
 /*
 Builtin environment operations calculation functions.
@@ -290,9 +530,6 @@ In builtin_envops_utils.c
 char		*get_env_key(const char *arg_str, int *key_len);
 void		free_envop_list(t_envop **head);
 void		err_invalid_export_arg(char *arg);
-int			copy_env_with_envop_list(char **env, t_envop *envop_list,
-				char **new_env);
-int			copy_env_with_ops(char **env, t_envop *env_list, char **new_env);
 
 /*
 Builtin environment operations functions. For use with cd, export,unset.
@@ -301,8 +538,7 @@ In builtin_envops.c
 t_envop		*make_envop_node(const char *arg, int flag);
 t_envop		*parse_envop_list(char **args, int op_type);
 void		add_envop_node(t_envop **head, t_envop *node);
-void		match_envline_to_env(t_envop *envop_list, char **env);
-char		**proc_envop_list(t_envop *envop_list, char **env);
+int			apply_envop_list(t_envop *envop_list, t_vars *vars);
 
 /*
 Builtin "exit" command. Exits the shell.
@@ -325,8 +561,27 @@ In builtin_export.c
 int			builtin_export(char **args, t_vars *vars);
 int			export_without_args(t_vars *vars);
 int			sort_env(int count, t_vars *vars);
-int			process_export_var(char *env_var);
-int			process_var_with_val(char *name, char *value);
+int			process_export_var(t_outbuf *out, char *env_var);
+int			process_var_with_val(t_outbuf *out, char *name, char *value);
+
+/*
+Builtin "hash" command. Manages the command hash table.
+In builtin_hash.c
+*/
+int			builtin_hash(char **args, t_vars *vars);
+int			hash_print_table(t_vars *vars);
+int			hash_add_cmd(char *name, t_vars *vars);
+int			hash_invalid_opt(char *opt);
+void		chk_path_change(t_envop *envop_list, t_vars *vars);
+
+/*
+Builtin "history" command. Lists or searches the command history.
+In builtin_history.c
+*/
+int			builtin_history(char **args, t_vars *vars);
+int			history_print_list(void);
+int			history_print_matches(t_histidx *idx, char *query);
+int			history_usage(char *arg);
 
 /*
 Builtin "pwd" command. Outputs the current working directory.
@@ -334,12 +589,22 @@ In builtin_pwd.c
 */
 int			builtin_pwd(t_vars *vars);	
 
+/*
+Builtin "shopt" command. Sets and shows the shell options.
+In builtin_shopt.c
+*/
+int			builtin_shopt(char **args, t_vars *vars);
+int			*shopt_flag(char *name, t_vars *vars);
+int			shopt_apply(char *name, int action, t_vars *vars);
+void		shopt_show(t_outbuf *out, char *name, int on, int action);
+int			shopt_invalid_opt(char *opt);
+
 /*
 Builtin "unset" command. Unsets an environment variable.
 In builtin_unset.c
 */
 int			builtin_unset(char **args, t_vars *vars);
-int			get_env_pos(char *key, char **env, int keylen);
+int			get_env_pos(char *key, int keylen, t_vars *vars);
 
 /* Main minishell functions. In srcs directory. */
 
@@ -357,11 +622,10 @@ int			join_arg_strings(t_node *tgt_append_tok, int arg_idx,
 Append arguments to a node's argument array.
 In append_args.c
 */
-char		**dup_node_args(t_node *node, size_t len);
-int			**dup_quote_types(t_node *node, size_t len);
-int			*set_char_quote_types(char *arg_text, int quote_type);
-int			**resize_quotype_arr(t_node *node, char *new_arg, int quote_type,
-				char **new_args);
+int			grow_node_args(t_node *node);
+int			*set_char_quote_types(char *arg_text, int quote_type,
+				t_arena *arena);
+int			append_arg_owned(t_node *node, char *new_arg, int *quote_types);
 void		append_arg(t_node *node, char *new_arg, int quote_type);
 
 /*
@@ -417,6 +681,33 @@ In cleanup_b.c
 void		free_token_node(t_node *node);
 void		free_null_token_stop(t_vars *vars);
 
+/*
+Per-command bump allocator for token and AST nodes.
+In arena.c
+*/
+size_t		arena_align(size_t size);
+t_arena_chunk	*arena_add_chunk(t_arena *arena, size_t size);
+void		*arena_alloc(t_arena *arena, size_t size);
+void		arena_reset(t_arena *arena);
+void		arena_destroy(t_arena *arena);
+
+/*
+Arena helpers.
+In arena_utils.c
+*/
+void		*arena_realloc(t_arena *arena, void *ptr, size_t old_size,
+				size_t new_size);
+
+/*
+Command hash table mapping command names to resolved paths.
+In cmd_hash.c
+*/
+int			cmd_hash_key(const char *name);
+t_cmdhash	*cmd_hash_find(t_vars *vars, const char *name);
+t_cmdhash	*cmd_hash_new(t_vars *vars, const char *name);
+t_cmdhash	*cmd_hash_store(t_vars *vars, const char *name, const char *path);
+void		cmd_hash_clear(t_vars *vars);
+
 /*
 Command finder function.
 In cmd_finder.c
@@ -427,6 +718,26 @@ void		reset_find_cmd(t_vars *vars, t_node *start, t_node *target,
 				int mode);
 t_node		*find_cmd(t_node *start, t_node *target, int mode, t_vars *vars);
 
+/*
+Hash index over the names in vars->env.
+In env_index.c
+*/
+int			env_hash(const char *name, int len);
+int			env_key_len(const char *line);
+int			env_index_find(t_vars *vars, const char *name, int len);
+void		env_index_insert(t_vars *vars, int env_pos);
+int			build_env_index(t_vars *vars);
+
+/*
+In-place environment updates and the envp snapshot.
+In env_store.c
+*/
+int			env_append(t_vars *vars, char *line);
+int			env_set_line(t_vars *vars, char *line);
+int			env_set(t_vars *vars, const char *key, const char *value);
+void		env_unset(t_vars *vars, const char *key);
+char		**get_envp(t_vars *vars);
+
 /*
 Error handling.
 In errormsg.c
@@ -442,9 +753,9 @@ Pipe execution functions.
 In execute_pipes.c
 */
 int			setup_pipe_cmd(t_node *node_in_pipe, t_vars *vars,
-				t_node **cmd_to_exec_out, int pipe_context);
-int			exec_pipe_left(t_node *cmd_node, int pipe_fd[2], t_vars *vars);
-int			exec_pipe_right(t_node *cmd_node, int pipe_fd[2], t_vars *vars);
+				t_node **cmd_to_exec);
+int			count_pipe_stages(t_node *pipe_node);
+t_node		*next_pipe_stage(t_node **cursor);
 int			execute_pipes(t_node *pipe_node, t_vars *vars);
 int			exec_solo_redir(t_node *redir_node, t_vars *vars);
 
@@ -492,16 +803,21 @@ char		*handle_special_var(const char *var_name, t_vars *vars);
 char		*get_var_value(const char *var_name, t_vars *vars);
 char		*expand_variable(char *input, int *pos, char *var_name,
 				t_vars *vars);
-char		*get_env_val(const char *var_name, char **env);
+char		*get_env_val(const char *var_name, t_vars *vars);
 char		*get_var_name(char *input, int *pos);
 
 /*
 Forking functions.
 In forking.c
 */
-pid_t		fork_left_pipe_branch(t_node *node, int pipe_fd[2], t_vars *vars);
-pid_t		fork_right_pipe_branch(t_node *node, int pipe_fd[2], t_vars *vars,
-				pid_t left_child_pid);
+int			exec_pipe_stage(t_node *stage, int in_fd, int out_pipe[2],
+				t_vars *vars);
+pid_t		fork_stage_child(t_node *stage, int in_fd, int out_pipe[2],
+				t_vars *vars);
+pid_t		fork_pipe_stage(t_node *stage, int *in_fd, int has_next,
+				t_vars *vars);
+int			wait_stage(pid_t pid, int *status);
+int			reap_pipe_stages(int started, t_vars *vars);
 
 /*
 Heredoc delimiter handling utility functions.
@@ -522,75 +838,153 @@ int			chk_hd_first_line(char *line_start, int len, t_vars *vars);
 int			proc_hd_line(int write_fd, char *line, t_vars *vars);
 void		strip_outer_quotes(char **delimiter, t_vars *vars);
 
+/*
+Collects every heredoc body of a command line before it runs.
+In heredoc_gather.c
+*/
+t_node		*find_hd_delim(t_node *hd_node);
+int			set_hd_delim(t_node *hd_node, t_vars *vars);
+int			read_hd_body(t_node *hd_node, t_vars *vars);
+int			gather_heredocs(t_vars *vars);
+
+/*
+Here-string (<<<) payload handling.
+In herestring.c
+*/
+char		*get_herestring_word(char *input, int *i);
+int			append_hs_word(t_strbuf *buf, char *word, t_vars *vars);
+int			build_herestring(t_node *hs_node, t_vars *vars);
+int			herestring_pipe(t_node *hs_node, t_strbuf *buf);
+int			read_herestring(t_node *hs_node, t_vars *vars);
+
 /*
 Heredoc expansion functions.
 In heredoc_expansion.c
 */
-char		*hd_expander(char *line, t_vars *vars);
-char		*prepare_hd_line(char *line, t_vars *vars);
-char		*expand_hd_var(char *line, int *pos, t_vars *vars);
-char		*read_hd_str(char *line, int *pos);
+int			hd_expander(t_strbuf *result, char *line, t_vars *vars);
+int			flush_hd_buf(int fd, char *tail, size_t tail_len,
+				t_vars *vars);
+int			append_hd_var(t_strbuf *result, char *line, int *pos,
+				t_vars *vars);
+int			append_hd_str(t_strbuf *result, char *line, int *pos);
 int			write_to_hd(int fd, char *line, t_vars *vars);
 
 /*
 Heredoc main handling utility functions.
 In heredoc_utils.c
 */
-char		*hd_merge_and_free(char *str, char *chunk);
-void		cleanup_heredoc_fd(int write_fd);
+int			open_hd_store(t_vars *vars);
+void		close_hd_store(t_vars *vars);
 int			proc_hd_delim(char *input, t_vars *vars, int *hd_is_delim);
 int			is_heredoc_target(t_node *node, t_vars *vars);
-int			read_tmp_buf(t_vars *vars);
 
 /*
 Heredoc main handling.
 In heredoc.c
 */
 void		setpipe(t_vars *vars);
-int			interactive_hd_mode(t_vars *vars, int sss, int status);
-int			hd_term(int saved_signal_state, t_vars *vars, int code,
-				char **line);
-void		exec_hd_child(t_vars *vars);
-int			process_hd_parent(pid_t child_pid, int child_status,
-				int saved_signal_state, t_vars *vars);
+int			interactive_hd_mode(t_vars *vars);
+int			hd_term(int saved_signal_state, int code, char **line);
 int			get_interactive_hd(int write_fd, t_vars *vars);
 int			handle_heredoc(t_node *node, t_vars *vars);
-int			process_heredoc(t_node *node, t_vars *vars);
 
 /*
 History loading functions.
 In history_load.c
 */
-void		read_history_lines(int fd);
-void		load_history(void);
+void		for_each_hist_line(char *data, size_t len, t_histline_fn fn,
+				void *ctx);
+void		add_history_cb(char *cmd, void *ctx);
+void		hist_dir_open(void);
+char		*map_history_file(size_t *len);
+void		load_history(t_vars *vars);
+
+/*
+Duplicate detection for the history search index.
+In hist_dedup.c
+*/
+unsigned int	hist_hash(const char *line);
+void		hist_dedup_insert(t_histidx *idx, int id);
+int			hist_dedup_find(t_histidx *idx, const char *line);
+int			hist_dedup_grow(t_histidx *idx);
+
+/*
+History search index building.
+In hist_index.c
+*/
+int			hist_entries_grow(t_histidx *idx);
+int			hist_index_add(t_histidx *idx, char *line);
+void		hist_index_cb(char *cmd, void *ctx);
+int			hist_index_load(t_histidx *idx);
+void		hist_index_free(t_histidx *idx);
+
+/*
+Trigram posting lists of the history search index.
+In hist_trigram.c
+*/
+int			tri_bucket(const char *s);
+int			postings_push(t_postings *list, int id);
+int			index_trigrams(t_histidx *idx, int id);
+t_postings	*shortest_postings(t_histidx *idx, const char *query);
+
+/*
+History search and its readline binding.
+In hist_search.c
+*/
+int			hist_pick(t_histidx *idx, int id, char *query, int below);
+int			hist_index_search(t_histidx *idx, char *query, int below);
+t_histidx	*hist_index_ptr(t_histidx *set);
+int			hist_search_key(int count, int key);
+void		init_hist_search(t_vars *vars);
 
 /*
 History saving functions.
 In history_save.c
 */
-int			prepare_history_entries(HIST_ENTRY ***hist_list,
-				int *history_count, int *start_idx);
-void		save_history(void);
-int			save_history_entries(int fd, HIST_ENTRY **hist_list,
-				int start, int total);
+int			open_history_locked(int flags);
+void		append_history_entry(char *line, time_t start, t_vars *vars);
+size_t		hist_keep_start(char *buf, size_t len, int keep);
+void		compact_history(int keep);
 
 /*
 History utility functions.
 In history_utils.c
 */
-void		trim_history(int excess_lines);
-int			chk_and_make_folder(const char *path);
-int			copy_file_content(int fd_src, int fd_dst);
-int			copy_file(const char *src, const char *dst);
-int			copy_to_temp(int fd_read);
+int			hist_dir_fd(int set);
+char		*read_history_file(int fd, size_t *len);
+int			write_compacted(char *data, size_t len);
+void		hist_lock_publish(int fd);
+void		close_history_locked(int fd);
+
+/*
+Background history writer thread.
+In history_writer.c
+*/
+t_histwr	*hist_writer_ptr(t_histwr *set);
+void		hist_writer_atfork_child(void);
+void		*hist_writer_main(void *arg);
+void		hist_writer_start(t_vars *vars);
+void		hist_writer_stop(t_histwr *wr);
+
+/*
+History writer queue functions.
+In history_queue.c
+*/
+void		hist_queue_push(t_histwr *wr, char *data, size_t len, int keep);
+void		hist_batch_flush(t_histwr *wr, t_strbuf *batch);
+void		hist_queue_drain(t_histwr *wr);
+void		hist_writer_sync(t_histwr *wr);
+void		hist_writer_wait(t_histwr *wr);
 
 /*
 History main functions.
 In history.c
 */
-void		skip_lines(int fd, int count);
-int			init_history_fd(int mode);
-int			get_history_count(void);
+int			hist_limit(const char *name, int fallback, t_vars *vars);
+int			hist_put_num(t_strbuf *sb, long n);
+int			format_hist_entry(t_strbuf *sb, char *line, time_t start,
+				int status);
+char		*hist_entry_cmd(char *line, char *end);
 
 /*
 Node initialization functions.
@@ -598,13 +992,13 @@ In initnode.c
 */
 int			make_nodeframe(t_node *node, t_tokentype type, char *token);
 void		set_quote_type(t_node *node, int quote_type);
-t_node		*initnode(t_tokentype type, char *token);
+t_node		*initnode(t_tokentype type, char *token, t_vars *vars);
 
 /*
 Shell and structure initialization functions.
 In initshell.c
 */
-void		init_shell(t_vars *vars, char **envp);
+void		init_shell(t_vars *vars, int argc, char **argv, char **envp);
 void		init_vars(t_vars *vars);
 t_pipe		*init_pipes(void);
 void		reset_pipe_vars(t_vars *vars);
@@ -624,10 +1018,18 @@ int			handle_unfinished_pipes(char **processed_cmd, t_vars *vars);
 Input processing functions.
 In input_handlers.c
 */
-char		*allocate_and_read(int fd, size_t size);
-char		*read_tmp_buf_file(const char *filename);
 void		handle_input(char *input, t_vars *vars);
 
+/*
+Line input for terminals, pipes and files.
+In input_line.c
+*/
+void		init_input(t_vars *vars, int argc, char **argv);
+char		*input_line(t_vars *vars, char *prompt);
+void		input_sync(t_vars *vars);
+int			input_at_end(t_vars *vars);
+void		close_input(t_vars *vars);
+
 /*
 Interrupt handling functions.
 In interrupt.c
@@ -636,6 +1038,13 @@ void		hd_abort_cleanup(t_vars *vars);
 void		hd_abort_state_reset(t_vars *vars);
 void		reset_shell_state_for_interrupt(t_vars *vars);
 
+/*
+Last pipeline stage run by the shell itself (shopt -s lastpipe).
+In lastpipe.c
+*/
+int			is_lastpipe_stage(t_node *stage, t_vars *vars);
+pid_t		run_lastpipe_stage(t_node *stage, int *in_fd, t_vars *vars);
+
 /*
 Lexer utility functions.
 In lexer_utils.c
@@ -661,7 +1070,8 @@ int			proc_join_args(t_vars *vars, char *expanded_val);
 int			handle_tok_join(char *input, t_vars *vars, char *expanded_val,
 				char *token);
 void		process_right_adj(char *input, t_vars *vars);
-int			realloc_quo_arr(int **quo_arr_ptr, size_t new_char_len);
+int			realloc_quo_arr(int **quo_arr_ptr, size_t new_char_len,
+				t_arena *arena);
 int			update_quote_types(t_vars *vars, int arg_idx, char *expanded_val);
 
 /*
@@ -681,8 +1091,8 @@ int			new_exp_token(t_vars *vars, char *expanded_val, char *token);
 Node array creation functions.
 In make_node_arrays.c
 */
-char		**setup_args(char *token);
-int			**setup_quotes(int len);
+char		**setup_args(char *token, t_arena *arena);
+int			**setup_quotes(int len, t_arena *arena);
 void		make_node_arrays(t_node *node, char *token);
 
 /*
@@ -705,20 +1115,19 @@ void		free_if_orphan_node(t_node *node, t_vars *vars);
 Minishell program entry point functions.
 In minishell.c
 */
-char		*reader(void);
+char		*reader(t_vars *vars);
 int			handle_pipe_syntax(t_vars *vars);
 void		process_command(char *command, t_vars *vars);
+void		run_input(char *input, t_vars *vars);
 int			main(int ac, char **av, char **envp);
 
 /*
 Multiline input buffer handling functions
 In multiline_input_buffer.c
 */
-char		*extract_next_line(char **current_pos_ptr, t_vars *vars);
-int			proc_hd_buffer(int fd, char *content, t_vars *vars);
+int			proc_hd_buffer(int fd, char **content, t_vars *vars);
 int			process_standard(char *input, t_vars *vars);
-int			open_hd_tmp_buf(t_vars *vars);
-int			handle_interactive_hd(int fd, int found_in_buf, t_vars *vars);
+int			handle_interactive_hd(int found_in_buf, t_vars *vars);
 
 /*
 Multiline validation functions.
@@ -736,6 +1145,7 @@ In operators_utils.c.
 */
 int			is_single_token(char *input, int pos, int *moves);
 int			is_double_token(char *input, int pos, int *moves);
+int			is_triple_token(char *input, int pos, int *moves);
 
 /*
 Operator handling.
@@ -745,6 +1155,16 @@ int			is_operator_token(t_tokentype type);
 void		handle_string(char *input, t_vars *vars);
 int			handle_pipe_operator(char *input, t_vars *vars);
 
+/*
+Buffered output of the builtins.
+In outbuf.c
+*/
+int			write_iov(int fd, struct iovec *iov, int cnt);
+int			out_flush(t_outbuf *out);
+int			out_write(t_outbuf *out, const char *data, size_t len);
+int			out_puts(t_outbuf *out, const char *str);
+int			out_flush_builtin(char *cmd, t_outbuf *out);
+
 /*
 Parsing functions.
 In parser.c
@@ -769,6 +1189,7 @@ Path finding functions.
 In paths.c
 */
 char		**get_path_env(char **envp);
+char		*search_path_dirs(char *cmd, char **paths);
 char		*search_in_env(char *cmd, char **envp, t_vars *vars);
 char		*handle_direct_path(char *cmd, t_vars *vars);
 char		*get_cmd_path(t_node *node, char **envp, t_vars *vars);
@@ -787,9 +1208,19 @@ int			finalize_pipes(t_vars *vars);
 Pipes main functions.
 In pipes.c
 */
-char		*read_until_complete(void);
+char		*read_until_complete(t_vars *vars);
 int			append_to_cmdline(char **cmd_ptr, const char *addition);
 
+/*
+Positional parameters ($0 to $9, $#, $@ and $*).
+In positional.c
+*/
+int			is_param_char(int c);
+char		*positional_var(const char *name, t_vars *vars);
+char		*positional_all(t_vars *vars);
+int			is_pos_words(char *input, char *var_name, t_vars *vars);
+int			make_pos_tokens(t_vars *vars, char *token);
+
 /*
 Quoted redirection target functions.
 In proc_quoted_redir_tgt.c
@@ -811,7 +1242,6 @@ int			proc_first_line(char *input, char *first_line_end, t_vars *vars);
 int			process_heredoc_path(char *input, char *first_line_end,
 				char *content_start, t_vars *vars);
 void		exec_first_line(char *input, char *nl_ptr, t_vars *vars);
-int			hd_proc_end(int fd, char *input, char *nl_ptr, t_vars *vars);
 
 /*
 Pipeline processing functions.
@@ -880,10 +1310,9 @@ Handles expansion in quotes.
 In quoted_expansion.c
 */
 char		*expand_quoted_str(char *content, t_vars *vars);
-char		*expand_quoted_var(char *expanded, char *content, int *pos,
+int			expand_quoted_var(t_strbuf *expanded, char *content, int *pos,
 				t_vars *vars);
-char		*append_basic_strs(char *expanded, char *content, int *pos);
-char		*append_substr(char *dest, char *src, int start, int len);
+int			append_basic_strs(t_strbuf *expanded, char *content, int *pos);
 
 /*
 Quote handling.
@@ -892,7 +1321,8 @@ In quotes.c
 void		track_quote_ctx(char quote_char, char *in_quote, int pos,
 				t_vars *vars);
 int			validate_quotes(char *input, t_vars *vars);
-char		*quote_prompt(char quote_type);
+char		*quote_prompt(char quote_type, t_vars *vars);
+void		quote_eof_error(char quote_type, t_vars *vars);
 
 /*
 Setup redirection functions.
@@ -924,12 +1354,30 @@ char		*parse_and_get_filename(char *input, int *i_ptr, int tgt_start,
 				char *quo_char);
 int			proc_redir_filename(char *input, int *i, t_node *redir_node);
 
+/*
+Script file input.
+In script.c
+*/
+void		open_script(char *path, t_vars *vars);
+int			open_cmd_string(int argc, char **argv, t_vars *vars);
+char		*script_line(t_script *script);
+char		*read_line_bytewise(int fd);
+
+/*
+Line reads from a stdin pipe that take nothing past the line.
+In input_peek.c
+*/
+void		init_pipe_input(t_vars *vars);
+ssize_t		peek_stdin(int *peek, t_strbuf *line);
+ssize_t		take_stdin(char *dst, ssize_t n);
+char		*read_line_peek(t_vars *vars);
+
 /*
 Shell level handling.
 In shell_level.c
 */
 int			get_shell_level(t_vars *vars);
-int			update_shlvl_env(char **env, int position, int new_level);
+int			update_shlvl_env(t_vars *vars, int new_level);
 int			incr_shell_level(t_vars *vars);
 
 /*
@@ -939,7 +1387,19 @@ In signals.c
 void		load_signals(void);
 void		sigint_handler(int sig);
 void		sigquit_handler(int sig);
-void		hd_child_sigint_handler(int signo);
+void		hd_sigint_handler(int signo);
+int			hd_event_hook(void);
+
+/*
+External command launching with posix_spawn().
+In spawn.c
+*/
+int			exec_error_code(int err);
+int			can_spawn_stage(t_node *stage);
+int			add_stage_actions(posix_spawn_file_actions_t *actions, int *io);
+pid_t		spawn_cmd(char *cmd_path, char **args, int *io, t_vars *vars);
+pid_t		spawn_pipe_stage(t_node *stage, int in_fd, int out_pipe[2],
+				t_vars *vars);
 
 /*
 Terminal state modification functions.
@@ -955,10 +1415,10 @@ Temporary buffer reader and processing.
 In tmp_buf_reader.c
 */
 int			init_read_buf(t_read_buf *rb);
-void		cleanup_rd_buf(t_read_buf *rb, int remove_tmp);
+void		cleanup_rd_buf(t_read_buf *rb);
 void		update_quote_state(char c, t_read_buf *rb);
 void		process_buffer_command(t_read_buf *rb, t_vars *vars);
-void		tmp_buf_reader(t_vars *vars);
+void		tmp_buf_reader(char *input, t_vars *vars);
 
 /*
 Tokenizing utility functions.
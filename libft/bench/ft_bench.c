@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_bench.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/29 14:40:07 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/29 21:36:12 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+Benchmark driver, see ft_bench.h. Prints one table per buffer size with
+the throughput of each version in GB/s. Versions the CPU cannot run are
+shown as "-".
+*/
+
+#include "ft_bench.h"
+
+static double	bench_one(t_runfn run, t_anyfn fn, char **bufs, size_t n)
+{
+	volatile size_t	sink;
+	size_t			iters;
+	size_t			i;
+	double			start;
+
+	iters = BENCH_TOTAL / n;
+	i = 0;
+	start = bench_now();
+	while (i < iters)
+	{
+		sink = run(fn, bufs[0], bufs[1], n);
+		i++;
+	}
+	(void)sink;
+	return ((double)iters * n / (bench_now() - start) / 1e9);
+}
+
+static void	bench_size(t_anyfn impls[BENCH_PRIMS][BENCH_IMPLS], char **bufs,
+		size_t n)
+{
+	static const char	*names[] = {"glibc", "ref", "swar", "sse2", "avx2"};
+	static const t_runfn	runs[] = {run_strlen, run_strchr, run_memchr,
+		run_memcmp, run_strncmp};
+	int					impl;
+	int					prim;
+
+	printf("\n%zu bytes      strlen   strchr   memchr   memcmp  strncmp\n", n);
+	impl = 0;
+	while (impl < BENCH_IMPLS)
+	{
+		printf("  %-10s", names[impl]);
+		prim = 0;
+		while (prim < BENCH_PRIMS)
+		{
+			if (impl > ft_cpu_level() + 2)
+				printf(" %8s", "-");
+			else
+				printf(" %8.2f", bench_one(runs[prim], impls[prim][impl],
+						bufs, n));
+			prim++;
+		}
+		printf("\n");
+		impl++;
+	}
+}
+
+static int	bench_all(t_anyfn impls[BENCH_PRIMS][BENCH_IMPLS])
+{
+	static const size_t	sizes[] = {16, 256, 4096, 65536, 1048576, 0};
+	char				*bufs[2];
+	int					i;
+
+	printf("CPU level: %d (0 swar, 1 sse2, 2 avx2), GB/s\n", ft_cpu_level());
+	i = 0;
+	while (sizes[i])
+	{
+		if (!bench_buffers(bufs, sizes[i]))
+			return (1);
+		bench_size(impls, bufs, sizes[i]);
+		free(bufs[0]);
+		free(bufs[1]);
+		i++;
+	}
+	return (0);
+}
+
+int	main(void)
+{
+	t_anyfn	impls[BENCH_PRIMS][BENCH_IMPLS] = {
+	{(t_anyfn)strlen, (t_anyfn)ft_strlen_ref, (t_anyfn)ft_strlen_swar,
+		(t_anyfn)ft_strlen_sse2, (t_anyfn)ft_strlen_avx2},
+	{(t_anyfn)strchr, (t_anyfn)ft_strchr_ref, (t_anyfn)ft_strchr_swar,
+		(t_anyfn)ft_strchr_sse2, (t_anyfn)ft_strchr_avx2},
+	{(t_anyfn)memchr, (t_anyfn)ft_memchr_ref, (t_anyfn)ft_memchr_swar,
+		(t_anyfn)ft_memchr_sse2, (t_anyfn)ft_memchr_avx2},
+	{(t_anyfn)memcmp, (t_anyfn)ft_memcmp_ref, (t_anyfn)ft_memcmp_swar,
+		(t_anyfn)ft_memcmp_sse2, (t_anyfn)ft_memcmp_avx2},
+	{(t_anyfn)strncmp, (t_anyfn)ft_strncmp_ref, (t_anyfn)ft_strncmp_swar,
+		(t_anyfn)ft_strncmp_sse2, (t_anyfn)ft_strncmp_avx2}};
+
+	return (bench_all(impls));
+}
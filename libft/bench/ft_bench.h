@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_bench.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/29 14:40:07 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/29 21:36:12 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_BENCH_H
+# define FT_BENCH_H
+
+/*
+Throughput benchmark of the string primitives, run with "make bench".
+Every version of each primitive scans BENCH_TOTAL bytes in total, over
+buffers of each size in the table, and is compared with glibc.
+*/
+
+# include "ft_simd.h"
+# include <stdio.h>
+# include <string.h>
+# include <time.h>
+
+# define BENCH_TOTAL 268435456UL
+# define BENCH_PRIMS 5
+# define BENCH_IMPLS 5
+
+typedef void	(*t_anyfn)(void);
+typedef size_t	(*t_runfn)(t_anyfn fn, const char *a, const char *b,
+		size_t n);
+
+size_t	run_strlen(t_anyfn fn, const char *a, const char *b, size_t n);
+size_t	run_strchr(t_anyfn fn, const char *a, const char *b, size_t n);
+size_t	run_memchr(t_anyfn fn, const char *a, const char *b, size_t n);
+size_t	run_memcmp(t_anyfn fn, const char *a, const char *b, size_t n);
+size_t	run_strncmp(t_anyfn fn, const char *a, const char *b, size_t n);
+double	bench_now(void);
+int		bench_buffers(char **bufs, size_t n);
+
+#endif
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_bench_ops.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/29 14:40:07 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/29 21:36:12 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+Calls one version of a primitive on the benchmark buffers. The buffers
+hold n bytes of 'a' followed by a NUL, and a and b are equal, so every
+call scans the whole buffer. The result is returned so that the call
+cannot be optimized away.
+*/
+
+#include "ft_bench.h"
+
+size_t	run_strlen(t_anyfn fn, const char *a, const char *b, size_t n)
+{
+	(void)b;
+	(void)n;
+	return (((t_strlen_fn)fn)(a));
+}
+
+size_t	run_strchr(t_anyfn fn, const char *a, const char *b, size_t n)
+{
+	(void)b;
+	(void)n;
+	return ((size_t)((t_strchr_fn)fn)(a, 'z'));
+}
+
+size_t	run_memchr(t_anyfn fn, const char *a, const char *b, size_t n)
+{
+	(void)b;
+	return ((size_t)((t_memchr_fn)fn)(a, 'z', n));
+}
+
+size_t	run_memcmp(t_anyfn fn, const char *a, const char *b, size_t n)
+{
+	return ((size_t)((t_memcmp_fn)fn)(a, b, n));
+}
+
+size_t	run_strncmp(t_anyfn fn, const char *a, const char *b, size_t n)
+{
+	return ((size_t)((t_strncmp_fn)fn)(a, b, n + 1));
+}
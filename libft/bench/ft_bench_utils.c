@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_bench_utils.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/29 14:40:07 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/29 21:36:12 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+Helpers of the benchmark driver. bench_now() reads the monotonic clock
+in seconds. bench_buffers() allocates the two n byte buffers, filled with
+'a' and NUL terminated, and returns 0 when either allocation fails.
+*/
+
+#include "ft_bench.h"
+
+double	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+int	bench_buffers(char **bufs, size_t n)
+{
+	bufs[0] = malloc(n + 1);
+	bufs[1] = malloc(n + 1);
+	if (!bufs[0] || !bufs[1])
+	{
+		free(bufs[0]);
+		free(bufs[1]);
+		return (0);
+	}
+	memset(bufs[0], 'a', n);
+	memset(bufs[1], 'a', n);
+	bufs[0][n] = '\0';
+	bufs[1][n] = '\0';
+	return (1);
+}
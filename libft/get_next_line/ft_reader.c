@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_reader.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/28 10:21:44 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/28 17:05:19 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+The t_reader functions read a file descriptor line by line through one
+reusable buffer.
+ft_rd_init() sets up a reader on fd with a buffer of cap bytes.
+ft_rd_fill() moves the unread bytes to the front of the buffer and reads
+once more into the space behind them. The buffer only grows, by doubling
+with ft_rd_grow(), when a single line does not fit in it.
+ft_rd_view() returns the next line in place, without copying it. The
+newline is replaced by a NUL and the line stays valid until the next call.
+Bytes are searched for '\n' with ft_memchr() once each, however many reads
+a line spans, so reading costs O(n) in the size of the input.
+ft_rd_line() returns the next line as a malloc(3)ed copy instead.
+ft_rd_view() and ft_rd_line() return the length of the line (the newline
+not included) and set nl when the line ended with one. They return -1 at
+end of file and on error, err telling the two apart.
+ft_rd_free() releases the buffer. The caller keeps ownership of fd.
+*/
+
+#include "get_next_line.h"
+
+int	ft_rd_fill(t_reader *rd)
+{
+	ssize_t	bytes;
+
+	if (rd->start > 0)
+	{
+		ft_memmove(rd->buf, rd->buf + rd->start, rd->end - rd->start);
+		rd->end -= rd->start;
+		rd->scan -= rd->start;
+		rd->start = 0;
+	}
+	if (rd->end == rd->cap && !ft_rd_grow(rd))
+		return (0);
+	bytes = read(rd->fd, rd->buf + rd->end, rd->cap - rd->end);
+	while (bytes < 0 && errno == EINTR)
+		bytes = read(rd->fd, rd->buf + rd->end, rd->cap - rd->end);
+	rd->eof = (bytes <= 0);
+	rd->err = (bytes < 0);
+	if (bytes > 0)
+		rd->end += bytes;
+	return (bytes > 0);
+}
+
+ssize_t	ft_rd_view(t_reader *rd, char **line)
+{
+	char	*nl;
+
+	nl = NULL;
+	while (!nl && !rd->err)
+	{
+		nl = ft_memchr(rd->buf + rd->scan, '\n', rd->end - rd->scan);
+		rd->scan = rd->end;
+		if (!nl && (rd->eof || !ft_rd_fill(rd)))
+			break ;
+	}
+	if (rd->err || (!nl && rd->start == rd->end))
+		return (-1);
+	rd->nl = (nl != NULL);
+	if (!nl)
+		nl = rd->buf + rd->end;
+	*nl = '\0';
+	*line = rd->buf + rd->start;
+	rd->start = nl - rd->buf + rd->nl;
+	rd->scan = rd->start;
+	return (nl - *line);
+}
+
+ssize_t	ft_rd_line(t_reader *rd, char **line)
+{
+	char	*view;
+	ssize_t	len;
+
+	*line = NULL;
+	len = ft_rd_view(rd, &view);
+	if (len < 0)
+		return (-1);
+	*line = malloc(len + 1);
+	if (!*line)
+	{
+		rd->err = 1;
+		return (-1);
+	}
+	ft_memcpy(*line, view, len + 1);
+	return (len);
+}
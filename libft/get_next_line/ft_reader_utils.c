@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_reader_utils.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/28 10:21:44 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/28 17:05:19 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+Set-up, growth and release of a t_reader, see ft_reader.c.
+ft_rd_grow() doubles the buffer and returns 1, or sets err and returns 0
+if malloc(3) fails.
+*/
+
+#include "get_next_line.h"
+
+int	ft_rd_init(t_reader *rd, int fd, size_t cap)
+{
+	if (cap < FT_RD_MIN_CAP)
+		cap = FT_RD_MIN_CAP;
+	rd->fd = fd;
+	rd->start = 0;
+	rd->scan = 0;
+	rd->end = 0;
+	rd->eof = 0;
+	rd->err = 0;
+	rd->nl = 0;
+	rd->cap = 0;
+	rd->buf = malloc(cap + 1);
+	if (!rd->buf)
+		return (0);
+	rd->cap = cap;
+	return (1);
+}
+
+int	ft_rd_grow(t_reader *rd)
+{
+	char	*new_buf;
+
+	new_buf = malloc(rd->cap * 2 + 1);
+	if (!new_buf)
+	{
+		rd->err = 1;
+		return (0);
+	}
+	ft_memcpy(new_buf, rd->buf, rd->end);
+	free(rd->buf);
+	rd->buf = new_buf;
+	rd->cap *= 2;
+	return (1);
+}
+
+void	ft_rd_free(t_reader *rd)
+{
+	if (rd->buf)
+		free(rd->buf);
+	rd->buf = NULL;
+	rd->cap = 0;
+	rd->start = 0;
+	rd->scan = 0;
+	rd->end = 0;
+}
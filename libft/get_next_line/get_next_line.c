@@ -12,105 +12,43 @@
 
 /*
 get_next_line is a function that reads a file line by line.
+Each fd gets its own t_reader (see ft_reader.c), so a line costs one
+copy and no rescanning of the bytes before it.
+The returned line keeps its newline, if it had one.
+get_next_line() frees the reader of fd once it hits end of file or an
+error. get_next_line_free() frees it early, for callers that stop reading
+before the end.
 */
 
 #include "get_next_line.h"
 
-char	*ft_newline(char *last_pos)
+char	*get_next_line(int fd)
 {
-	int		i;
-	char	*str;
+	t_reader	*rd;
+	char		*view;
+	char		*line;
+	ssize_t		len;
 
-	i = 0;
-	if (!last_pos[i])
-		return (NULL);
-	while (last_pos[i] && last_pos[i] != '\n')
-		i++;
-	str = (char *)malloc(sizeof(char) * (i + 2));
-	if (!str)
+	rd = gnl_reader(fd, 0);
+	if (!rd)
 		return (NULL);
-	i = 0;
-	while (last_pos[i] && last_pos[i] != '\n')
-	{
-		str[i] = last_pos[i];
-		i++;
-	}
-	if (last_pos[i] == '\n')
-	{
-		str[i] = last_pos[i];
-		i++;
-	}
-	str[i] = '\0';
-	return (str);
-}
-
-char	*ft_trim(char *last_pos)
-{
-	int		i;
-	int		j;
-	char	*str;
-
-	i = 0;
-	while (last_pos[i] && last_pos[i] != '\n')
-		i++;
-	if (!last_pos[i])
+	len = ft_rd_view(rd, &view);
+	if (len < 0)
 	{
-		ft_safefree((void **)&last_pos);
+		gnl_reader(fd, 1);
 		return (NULL);
 	}
-	str = (char *)malloc(sizeof(char) * (ft_strlen(last_pos) - i + 1));
-	if (!str)
-	{
-		ft_safefree((void **)&str);
+	line = malloc(len + rd->nl + 1);
+	if (!line)
 		return (NULL);
-	}
-	i++;
-	j = 0;
-	while (last_pos[i])
-		str[j++] = last_pos[i++];
-	str[j] = '\0';
-	ft_safefree((void **)&last_pos);
-	return (str);
+	ft_memcpy(line, view, len);
+	if (rd->nl)
+		line[len++] = '\n';
+	line[len] = '\0';
+	return (line);
 }
 
-char	*ft_read_fd(int fd, char *last_pos)
+void	get_next_line_free(int fd)
 {
-	char	*buffer;
-	int		bytes_read;
-
-	bytes_read = 1;
-	buffer = malloc((BUFFER_SIZE + 1) * sizeof(char));
-	if (!buffer)
-		return (NULL);
-	if (NULL == last_pos)
-		last_pos = ft_strdup("");
-	while (!ft_strchr(last_pos, '\n') && bytes_read != 0)
-	{
-		bytes_read = read(fd, buffer, BUFFER_SIZE);
-		if (bytes_read == -1)
-		{
-			ft_safefree((void **)&buffer);
-			ft_safefree((void **)&last_pos);
-			return (NULL);
-		}
-		buffer[bytes_read] = '\0';
-		last_pos = ft_gstrjoin(last_pos, buffer);
-	}
-	ft_safefree((void **)&buffer);
-	return (last_pos);
-}
-
-char	*get_next_line(int fd)
-{
-	static char		*last_pos[MAX_FD];
-	char			*release_str;
-
-	if (fd < 0 || BUFFER_SIZE <= 0 || fd > MAX_FD)
-		return (NULL);
-	last_pos[fd] = ft_read_fd(fd, last_pos[fd]);
-	if (last_pos[fd] == NULL)
-		return (NULL);
-	release_str = ft_newline(last_pos[fd]);
-	last_pos[fd] = ft_trim(last_pos[fd]);
-	return (release_str);
+	gnl_reader(fd, 1);
 }
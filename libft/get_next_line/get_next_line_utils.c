@@ -10,31 +10,34 @@
 /*                                                                            */
 /* ************************************************************************** */
 
+/*
+gnl_reader() keeps the t_reader of each fd for get_next_line().
+It creates the reader of fd on first use and returns it, or frees it and
+returns NULL when release is set.
+*/
+
 #include "get_next_line.h"
 
-char	*ft_gstrjoin(char *s1, char *s2)
+t_reader	*gnl_reader(int fd, int release)
 {
-	size_t	len1;
-	size_t	len2;
-	char	*s3;
+	static t_reader	*readers[MAX_FD];
 
-	if (!s1)
+	if (fd < 0 || fd >= MAX_FD || BUFFER_SIZE <= 0)
+		return (NULL);
+	if (release)
 	{
-		s1 = (char *)malloc(1 * sizeof(char));
-		if (!s1)
+		if (readers[fd])
+			ft_rd_free(readers[fd]);
+		ft_safefree((void **)&readers[fd]);
+		return (NULL);
+	}
+	if (!readers[fd])
+	{
+		readers[fd] = malloc(sizeof(t_reader));
+		if (!readers[fd])
 			return (NULL);
-		s1[0] = '\0';
+		if (!ft_rd_init(readers[fd], fd, BUFFER_SIZE))
+			ft_safefree((void **)&readers[fd]);
 	}
-	if (!s2)
-		return (NULL);
-	len1 = ft_strlen(s1);
-	len2 = ft_strlen(s2);
-	s3 = malloc((len1 + len2 + 1) * sizeof(char));
-	if (!s3)
-		return (NULL);
-	ft_memcpy(s3, s1, len1);
-	ft_memcpy(s3 + len1, s2, len2);
-	s3[len1 + len2] = '\0';
-	ft_safefree((void **)&s1);
-	return (s3);
+	return (readers[fd]);
 }
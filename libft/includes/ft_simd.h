@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_simd.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/29 10:08:51 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/29 21:36:12 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_SIMD_H
+# define FT_SIMD_H
+
+/*
+Internal header of the vectorized string primitives.
+ft_strlen(), ft_strchr(), ft_memchr(), ft_memcmp() and ft_strncmp() each
+have a byte-at-a-time reference version (_ref), a word-at-a-time version
+(_swar) and SSE2 and AVX2 versions. The public names are GNU indirect
+functions: the dynamic loader runs their resolver once at startup, which
+picks the best version for the CPU through ft_cpu_level().
+The word and vector versions read whole aligned blocks, which can go past
+the end of a string but never past the page it ends in. They are built
+without AddressSanitizer instrumentation for that reason, and so are the
+resolvers, which run before the sanitizer runtime is set up.
+*/
+
+# include "libft.h"
+# include <stdint.h>
+
+# if defined(__x86_64__) || defined(__i386__)
+#  define FT_X86 1
+#  include <immintrin.h>
+# else
+#  define FT_X86 0
+# endif
+
+# define FT_CPU_SWAR 0
+# define FT_CPU_SSE2 1
+# define FT_CPU_AVX2 2
+
+# define FT_PAGE_SZ 4096
+# define FT_ONES 0x0101010101010101ULL
+# define FT_HIGHS 0x8080808080808080ULL
+
+/*
+FT_HASZERO() is non-zero when one of the 8 bytes of v is zero.
+FT_CROSSES_PAGE() is true when w bytes read at p would reach the next page.
+*/
+# define FT_HASZERO(v) (((v) - FT_ONES) & ~(v) & FT_HIGHS)
+# define FT_CROSSES_PAGE(p, w) \
+	(((uintptr_t)(p) & (FT_PAGE_SZ - 1)) > (uintptr_t)(FT_PAGE_SZ - (w)))
+
+# define FT_NOSAN __attribute__((no_sanitize_address))
+# define FT_AVX2 __attribute__((target("avx2"), no_sanitize_address))
+
+typedef uint64_t __attribute__((may_alias, aligned(1)))	t_ftword;
+
+typedef size_t							(*t_strlen_fn)(const char *);
+typedef char							*(*t_strchr_fn)(const char *, int);
+typedef void							*(*t_memchr_fn)(const void *, int,
+		size_t);
+typedef int								(*t_memcmp_fn)(const void *,
+		const void *, size_t);
+typedef int								(*t_strncmp_fn)(const char *,
+		const char *, size_t);
+
+int			ft_cpu_level(void);
+
+size_t		ft_strlen_ref(const char *str);
+char		*ft_strchr_ref(const char *str, int character);
+void		*ft_memchr_ref(const void *str, int c, size_t n);
+int			ft_memcmp_ref(const void *s1, const void *s2, size_t n);
+int			ft_strncmp_ref(const char *str1, const char *str2, size_t n);
+char		*ft_strnstr_ref(const char *pile, const char *find, size_t len);
+
+size_t		ft_strlen_swar(const char *str);
+char		*ft_strchr_swar(const char *str, int character);
+void		*ft_memchr_swar(const void *str, int c, size_t n);
+int			ft_memcmp_swar(const void *s1, const void *s2, size_t n);
+int			ft_strncmp_swar(const char *str1, const char *str2, size_t n);
+
+# if FT_X86
+
+size_t		ft_strlen_sse2(const char *str);
+char		*ft_strchr_sse2(const char *str, int character);
+void		*ft_memchr_sse2(const void *str, int c, size_t n);
+int			ft_memcmp_sse2(const void *s1, const void *s2, size_t n);
+int			ft_strncmp_sse2(const char *str1, const char *str2, size_t n);
+
+size_t		ft_strlen_avx2(const char *str);
+char		*ft_strchr_avx2(const char *str, int character);
+void		*ft_memchr_avx2(const void *str, int c, size_t n);
+int			ft_memcmp_avx2(const void *s1, const void *s2, size_t n);
+int			ft_strncmp_avx2(const char *str1, const char *str2, size_t n);
+
+# else
+
+#  define ft_strlen_sse2 ft_strlen_swar
+#  define ft_strchr_sse2 ft_strchr_swar
+#  define ft_memchr_sse2 ft_memchr_swar
+#  define ft_memcmp_sse2 ft_memcmp_swar
+#  define ft_strncmp_sse2 ft_strncmp_swar
+#  define ft_strlen_avx2 ft_strlen_swar
+#  define ft_strchr_avx2 ft_strchr_swar
+#  define ft_memchr_avx2 ft_memchr_swar
+#  define ft_memcmp_avx2 ft_memcmp_swar
+#  define ft_strncmp_avx2 ft_strncmp_swar
+
+# endif
+
+#endif
@@ -18,20 +18,49 @@
 # endif 
 
 # ifndef BUFFER_SIZE
-#  define BUFFER_SIZE 1000
+#  define BUFFER_SIZE 65536
 # endif
 
+# define FT_RD_MIN_CAP 64
+
 # include "libft.h"
 # include <stdlib.h>
 # include <unistd.h>
 # include <string.h>
 # include <stddef.h>
 # include <limits.h>
+# include <errno.h>
+
+/*
+Line reader over a file descriptor, see ft_reader.c.
+- buf: cap bytes of input plus room for a terminating NUL.
+- start: first byte of the next line.
+- scan: first byte not yet searched for a newline.
+- end: end of the bytes read so far.
+- eof, err: set once read(2) returned 0 or failed.
+- nl: whether the last line returned ended with a newline.
+*/
+typedef struct s_reader
+{
+	int		fd;
+	char	*buf;
+	size_t	cap;
+	size_t	start;
+	size_t	scan;
+	size_t	end;
+	int		eof;
+	int		err;
+	int		nl;
+}	t_reader;
 
-char	*get_next_line(int fd);
-char	*ft_read_fd(int fd, char *last_pos);
-char	*ft_newline(char *last_pos);
-char	*ft_trim(char *last_pos);
-char	*ft_gstrjoin(char *s1, char *s2);
+char		*get_next_line(int fd);
+void		get_next_line_free(int fd);
+t_reader	*gnl_reader(int fd, int release);
+int			ft_rd_init(t_reader *rd, int fd, size_t cap);
+int			ft_rd_grow(t_reader *rd);
+int			ft_rd_fill(t_reader *rd);
+ssize_t		ft_rd_view(t_reader *rd, char **line);
+ssize_t		ft_rd_line(t_reader *rd, char **line);
+void		ft_rd_free(t_reader *rd);
 
 #endif
\ No newline at end of file
@@ -34,12 +34,21 @@
 #  define LLONG_MIN 9223372036854775807LL
 # endif
 
+# define FT_SB_MIN_CAP 16
+
 typedef struct s_list
 {
 	void			*content;
 	struct s_list	*next;
 }	t_list;
 
+typedef struct s_strbuf
+{
+	char			*buf;
+	size_t			len;
+	size_t			cap;
+}	t_strbuf;
+
 size_t		ft_arrlen(char **array);
 int			ft_atoi(const char *str);
 int			*ft_atoiarr_cln(char **temparr, int len);
@@ -79,6 +88,11 @@ void		ft_putstr(char *s);
 void		ft_safefree(void **ptr);
 char		**ft_split(char const *s, char c);
 char		**ft_splitstr(char const *s, char *delimiters);
+int			ft_sb_init(t_strbuf *sb, size_t cap);
+int			ft_sb_reserve(t_strbuf *sb, size_t extra);
+int			ft_sb_append(t_strbuf *sb, const char *s, size_t n);
+char		*ft_sb_take(t_strbuf *sb);
+void		ft_sb_free(t_strbuf *sb);
 char		*ft_strchr(const char *str, int character);
 int			ft_strcmp(const char *str1, const char *str2);
 char		*ft_strdup(const char *str);
@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_cpu_level.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/29 10:08:51 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/29 21:36:12 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+The ft_cpu_level() function reports the widest string primitives the CPU
+can run: FT_CPU_AVX2, FT_CPU_SSE2 or FT_CPU_SWAR. It runs from the indirect
+function resolvers, before constructors, so it initializes the CPU model
+itself with __builtin_cpu_init() and is not instrumented (FT_NOSAN).
+*/
+
+#include "ft_simd.h"
+
+#if FT_X86
+
+FT_NOSAN int	ft_cpu_level(void)
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return (FT_CPU_AVX2);
+	if (__builtin_cpu_supports("sse2"))
+		return (FT_CPU_SSE2);
+	return (FT_CPU_SWAR);
+}
+
+#else
+
+FT_NOSAN int	ft_cpu_level(void)
+{
+	return (FT_CPU_SWAR);
+}
+
+#endif
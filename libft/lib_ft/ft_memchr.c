@@ -16,11 +16,13 @@ to by str for the first instance of c. Both c and the bytes of the memory
 area pointed to by str are interpreted as unsigned char. The function returns
 a pointer to the matching byte or NULL if the character does not occur in the
 given memory area.
+ft_memchr_ref() is the byte-at-a-time reference version. ft_memchr() itself
+resolves to the fastest version the CPU supports, see ft_simd.h.
 */
 
-#include "libft.h"
+#include "ft_simd.h"
 
-void	*ft_memchr(const void *str, int c, size_t n)
+void	*ft_memchr_ref(const void *str, int c, size_t n)
 {
 	unsigned char		target;
 	const unsigned char	*src;
@@ -37,3 +39,18 @@ void	*ft_memchr(const void *str, int c, size_t n)
 	}
 	return (NULL);
 }
+
+static FT_NOSAN t_memchr_fn	ft_memchr_resolve(void)
+{
+	int	level;
+
+	level = ft_cpu_level();
+	if (level == FT_CPU_AVX2)
+		return (ft_memchr_avx2);
+	if (level == FT_CPU_SSE2)
+		return (ft_memchr_sse2);
+	return (ft_memchr_swar);
+}
+
+void	*ft_memchr(const void *str, int c, size_t n)
+	__attribute__((ifunc("ft_memchr_resolve")));
@@ -19,11 +19,13 @@ or be greater than the first n bytes of s2.
 For a nonzero return value, the sign is determined by the sign of the
 difference between the first pair of bytes (interpreted as unsigned char)
 that differ in s1 and s2. If n is zero, the return value is zero.
+ft_memcmp_ref() is the byte-at-a-time reference version. ft_memcmp() itself
+resolves to the fastest version the CPU supports, see ft_simd.h.
 */
 
-#include "libft.h"
+#include "ft_simd.h"
 
-int	ft_memcmp(const void *s1, const void *s2, size_t n)
+int	ft_memcmp_ref(const void *s1, const void *s2, size_t n)
 {
 	const unsigned char	*p1;
 	const unsigned char	*p2;
@@ -41,3 +43,18 @@ int	ft_memcmp(const void *s1, const void *s2, size_t n)
 	}
 	return (0);
 }
+
+static FT_NOSAN t_memcmp_fn	ft_memcmp_resolve(void)
+{
+	int	level;
+
+	level = ft_cpu_level();
+	if (level == FT_CPU_AVX2)
+		return (ft_memcmp_avx2);
+	if (level == FT_CPU_SSE2)
+		return (ft_memcmp_sse2);
+	return (ft_memcmp_swar);
+}
+
+int	ft_memcmp(const void *s1, const void *s2, size_t n)
+	__attribute__((ifunc("ft_memcmp_resolve")));
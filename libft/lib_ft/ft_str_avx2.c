@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_str_avx2.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/29 10:08:51 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/29 21:36:12 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+AVX2 versions of the string primitives, see ft_simd.h.
+They work like the SSE2 versions in ft_str_sse2.c on 32-byte blocks. Each
+function is compiled for AVX2 on its own (FT_AVX2), so the rest of libft
+keeps running on CPUs without it.
+*/
+
+#include "ft_simd.h"
+
+#if FT_X86
+
+FT_AVX2 size_t	ft_strlen_avx2(const char *str)
+{
+	const char		*p;
+	__m256i			zero;
+	unsigned int	mask;
+
+	p = (const char *)((uintptr_t)str & ~(uintptr_t)31);
+	zero = _mm256_setzero_si256();
+	mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+				_mm256_load_si256((const __m256i *)p), zero)) >> (str - p);
+	if (mask)
+		return (__builtin_ctz(mask));
+	while (!mask)
+	{
+		p += 32;
+		mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+					_mm256_load_si256((const __m256i *)p), zero));
+	}
+	return (p - str + __builtin_ctz(mask));
+}
+
+FT_AVX2 char	*ft_strchr_avx2(const char *str, int character)
+{
+	const char		*p;
+	__m256i			pat;
+	__m256i			block;
+	unsigned int	mask;
+
+	p = (const char *)((uintptr_t)str & ~(uintptr_t)31);
+	pat = _mm256_set1_epi8((char)character);
+	block = _mm256_load_si256((const __m256i *)p);
+	mask = (unsigned int)_mm256_movemask_epi8(_mm256_or_si256(
+				_mm256_cmpeq_epi8(block, pat), _mm256_cmpeq_epi8(block,
+					_mm256_setzero_si256()))) >> (str - p);
+	p = str;
+	while (!mask)
+	{
+		p = (const char *)(((uintptr_t)p + 32) & ~(uintptr_t)31);
+		block = _mm256_load_si256((const __m256i *)p);
+		mask = _mm256_movemask_epi8(_mm256_or_si256(
+					_mm256_cmpeq_epi8(block, pat),
+					_mm256_cmpeq_epi8(block, _mm256_setzero_si256())));
+	}
+	str = p + __builtin_ctz(mask);
+	if (*str == (char)character)
+		return ((char *)str);
+	return (NULL);
+}
+
+FT_AVX2 void	*ft_memchr_avx2(const void *str, int c, size_t n)
+{
+	const char		*p;
+	__m256i			pat;
+	unsigned int	mask;
+
+	p = (const char *)str;
+	pat = _mm256_set1_epi8((char)c);
+	while (n >= 32)
+	{
+		mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+					_mm256_loadu_si256((const __m256i *)p), pat));
+		if (mask)
+			return ((void *)(p + __builtin_ctz(mask)));
+		p += 32;
+		n -= 32;
+	}
+	return (ft_memchr_sse2(p, c, n));
+}
+
+FT_AVX2 int	ft_memcmp_avx2(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*p1;
+	const unsigned char	*p2;
+	unsigned int		mask;
+
+	p1 = (const unsigned char *)s1;
+	p2 = (const unsigned char *)s2;
+	while (n >= 32)
+	{
+		mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+					_mm256_loadu_si256((const __m256i *)p1),
+					_mm256_loadu_si256((const __m256i *)p2)));
+		if (mask != 0xFFFFFFFFu)
+			break ;
+		p1 += 32;
+		p2 += 32;
+		n -= 32;
+	}
+	return (ft_memcmp_sse2(p1, p2, n));
+}
+
+FT_AVX2 int	ft_strncmp_avx2(const char *str1, const char *str2, size_t n)
+{
+	__m256i			b1;
+	__m256i			b2;
+	unsigned int	stop;
+
+	while (n >= 32 && !FT_CROSSES_PAGE(str1, 32)
+		&& !FT_CROSSES_PAGE(str2, 32))
+	{
+		b1 = _mm256_loadu_si256((const __m256i *)str1);
+		b2 = _mm256_loadu_si256((const __m256i *)str2);
+		stop = ~(unsigned int)_mm256_movemask_epi8(
+				_mm256_cmpeq_epi8(b1, b2))
+			| (unsigned int)_mm256_movemask_epi8(
+				_mm256_cmpeq_epi8(b1, _mm256_setzero_si256()));
+		if (stop)
+			break ;
+		str1 += 32;
+		str2 += 32;
+		n -= 32;
+	}
+	return (ft_strncmp_sse2(str1, str2, n));
+}
+
+#endif
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_str_sse2.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/29 10:08:51 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/29 21:36:12 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+SSE2 versions of the string primitives, see ft_simd.h.
+Each step compares 16 bytes and turns the result into a bit mask with
+_mm_movemask_epi8(), whose lowest set bit is the first matching byte.
+The string functions only make aligned loads, which never cross a page,
+and ignore the bytes of the first block that come before the string.
+ft_strncmp_sse2() does not know where its strings end, so it only loads
+blocks that stay within their page and leaves the rest to the reference
+version.
+*/
+
+#include "ft_simd.h"
+
+#if FT_X86
+
+FT_NOSAN size_t	ft_strlen_sse2(const char *str)
+{
+	const char	*p;
+	__m128i		zero;
+	int			mask;
+
+	p = (const char *)((uintptr_t)str & ~(uintptr_t)15);
+	zero = _mm_setzero_si128();
+	mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+				_mm_load_si128((const __m128i *)p), zero)) >> (str - p);
+	if (mask)
+		return (__builtin_ctz(mask));
+	while (!mask)
+	{
+		p += 16;
+		mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+					_mm_load_si128((const __m128i *)p), zero));
+	}
+	return (p - str + __builtin_ctz(mask));
+}
+
+FT_NOSAN char	*ft_strchr_sse2(const char *str, int character)
+{
+	const char	*p;
+	__m128i		pat;
+	__m128i		block;
+	int			mask;
+
+	p = (const char *)((uintptr_t)str & ~(uintptr_t)15);
+	pat = _mm_set1_epi8((char)character);
+	block = _mm_load_si128((const __m128i *)p);
+	mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, pat),
+				_mm_cmpeq_epi8(block, _mm_setzero_si128()))) >> (str - p);
+	p = str;
+	while (!mask)
+	{
+		p = (const char *)(((uintptr_t)p + 16) & ~(uintptr_t)15);
+		block = _mm_load_si128((const __m128i *)p);
+		mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, pat),
+					_mm_cmpeq_epi8(block, _mm_setzero_si128())));
+	}
+	str = p + __builtin_ctz(mask);
+	if (*str == (char)character)
+		return ((char *)str);
+	return (NULL);
+}
+
+FT_NOSAN void	*ft_memchr_sse2(const void *str, int c, size_t n)
+{
+	const char	*p;
+	__m128i		pat;
+	int			mask;
+
+	p = (const char *)str;
+	pat = _mm_set1_epi8((char)c);
+	while (n >= 16)
+	{
+		mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+					_mm_loadu_si128((const __m128i *)p), pat));
+		if (mask)
+			return ((void *)(p + __builtin_ctz(mask)));
+		p += 16;
+		n -= 16;
+	}
+	return (ft_memchr_ref(p, c, n));
+}
+
+FT_NOSAN int	ft_memcmp_sse2(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*p1;
+	const unsigned char	*p2;
+	int					mask;
+
+	p1 = (const unsigned char *)s1;
+	p2 = (const unsigned char *)s2;
+	while (n >= 16)
+	{
+		mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+					_mm_loadu_si128((const __m128i *)p1),
+					_mm_loadu_si128((const __m128i *)p2)));
+		if (mask != 0xFFFF)
+			break ;
+		p1 += 16;
+		p2 += 16;
+		n -= 16;
+	}
+	return (ft_memcmp_ref(p1, p2, n));
+}
+
+FT_NOSAN int	ft_strncmp_sse2(const char *str1, const char *str2, size_t n)
+{
+	__m128i	b1;
+	__m128i	b2;
+	int		stop;
+
+	while (n >= 16 && !FT_CROSSES_PAGE(str1, 16)
+		&& !FT_CROSSES_PAGE(str2, 16))
+	{
+		b1 = _mm_loadu_si128((const __m128i *)str1);
+		b2 = _mm_loadu_si128((const __m128i *)str2);
+		stop = (~_mm_movemask_epi8(_mm_cmpeq_epi8(b1, b2)) & 0xFFFF)
+			| _mm_movemask_epi8(_mm_cmpeq_epi8(b1, _mm_setzero_si128()));
+		if (stop)
+			break ;
+		str1 += 16;
+		str2 += 16;
+		n -= 16;
+	}
+	return (ft_strncmp_ref(str1, str2, n));
+}
+
+#endif
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_str_swar.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/29 10:08:51 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/29 21:36:12 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+Word-at-a-time (SWAR) versions of the string primitives, see ft_simd.h.
+They test 8 bytes at once with FT_HASZERO(): a byte equal to c shows up
+as a zero byte of word ^ (c * FT_ONES). The string functions first step
+to an 8-byte boundary, so their aligned reads never cross a page. Once a
+word holds the byte looked for, the bytes of that word are checked one by
+one, and the counted functions hand their last bytes to the reference
+versions.
+*/
+
+#include "ft_simd.h"
+
+FT_NOSAN size_t	ft_strlen_swar(const char *str)
+{
+	const char		*p;
+	const t_ftword	*w;
+
+	p = str;
+	while ((uintptr_t)p & 7)
+	{
+		if (!*p)
+			return (p - str);
+		p++;
+	}
+	w = (const t_ftword *)p;
+	while (!FT_HASZERO(*w))
+		w++;
+	p = (const char *)w;
+	while (*p)
+		p++;
+	return (p - str);
+}
+
+FT_NOSAN char	*ft_strchr_swar(const char *str, int character)
+{
+	const t_ftword	*w;
+	uint64_t		pat;
+	unsigned char	c;
+
+	c = (unsigned char)character;
+	while ((uintptr_t)str & 7)
+	{
+		if (*str == (char)c)
+			return ((char *)str);
+		if (!*str)
+			return (NULL);
+		str++;
+	}
+	pat = FT_ONES * c;
+	w = (const t_ftword *)str;
+	while (!FT_HASZERO(*w) && !FT_HASZERO(*w ^ pat))
+		w++;
+	return (ft_strchr_ref((const char *)w, character));
+}
+
+FT_NOSAN void	*ft_memchr_swar(const void *str, int c, size_t n)
+{
+	const unsigned char	*p;
+	uint64_t			pat;
+
+	p = (const unsigned char *)str;
+	pat = FT_ONES * (unsigned char)c;
+	while (n >= 8 && !FT_HASZERO(*(const t_ftword *)p ^ pat))
+	{
+		p += 8;
+		n -= 8;
+	}
+	return (ft_memchr_ref(p, c, n));
+}
+
+FT_NOSAN int	ft_memcmp_swar(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*p1;
+	const unsigned char	*p2;
+
+	p1 = (const unsigned char *)s1;
+	p2 = (const unsigned char *)s2;
+	while (n >= 8 && *(const t_ftword *)p1 == *(const t_ftword *)p2)
+	{
+		p1 += 8;
+		p2 += 8;
+		n -= 8;
+	}
+	return (ft_memcmp_ref(p1, p2, n));
+}
+
+FT_NOSAN int	ft_strncmp_swar(const char *str1, const char *str2, size_t n)
+{
+	uint64_t	w1;
+
+	while (n >= 8 && !FT_CROSSES_PAGE(str1, 8) && !FT_CROSSES_PAGE(str2, 8))
+	{
+		w1 = *(const t_ftword *)str1;
+		if (w1 != *(const t_ftword *)str2 || FT_HASZERO(w1))
+			break ;
+		str1 += 8;
+		str2 += 8;
+		n -= 8;
+	}
+	return (ft_strncmp_ref(str1, str2, n));
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strbuf.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/20 15:02:37 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/20 19:44:12 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+The t_strbuf functions build a string in a single growable buffer.
+ft_sb_init() prepares an empty buffer with room for at least cap bytes.
+ft_sb_reserve() makes room for extra more bytes, doubling the capacity so
+that a sequence of appends costs amortized O(1) per byte.
+ft_sb_append() appends n bytes of s and keeps the buffer NUL terminated.
+ft_sb_take() hands the finished string to the caller and resets the buffer,
+so the result is the buffer itself and no final copy is made.
+ft_sb_free() releases the buffer without returning it.
+ft_sb_init(), ft_sb_reserve() and ft_sb_append() return 1 on success and 0
+if malloc(3) fails, in which case the buffer keeps its previous content.
+*/
+
+#include "libft.h"
+
+int	ft_sb_init(t_strbuf *sb, size_t cap)
+{
+	if (cap < FT_SB_MIN_CAP)
+		cap = FT_SB_MIN_CAP;
+	sb->len = 0;
+	sb->cap = 0;
+	sb->buf = malloc(cap);
+	if (!sb->buf)
+		return (0);
+	sb->cap = cap;
+	sb->buf[0] = '\0';
+	return (1);
+}
+
+int	ft_sb_reserve(t_strbuf *sb, size_t extra)
+{
+	char	*new_buf;
+	size_t	new_cap;
+
+	if (sb->len + extra + 1 <= sb->cap)
+		return (1);
+	new_cap = sb->cap * 2;
+	if (new_cap < FT_SB_MIN_CAP)
+		new_cap = FT_SB_MIN_CAP;
+	while (new_cap < sb->len + extra + 1)
+		new_cap *= 2;
+	new_buf = malloc(new_cap);
+	if (!new_buf)
+		return (0);
+	if (sb->buf)
+		ft_memcpy(new_buf, sb->buf, sb->len + 1);
+	else
+		new_buf[0] = '\0';
+	free(sb->buf);
+	sb->buf = new_buf;
+	sb->cap = new_cap;
+	return (1);
+}
+
+int	ft_sb_append(t_strbuf *sb, const char *s, size_t n)
+{
+	if (!ft_sb_reserve(sb, n))
+		return (0);
+	ft_memcpy(sb->buf + sb->len, s, n);
+	sb->len += n;
+	sb->buf[sb->len] = '\0';
+	return (1);
+}
+
+char	*ft_sb_take(t_strbuf *sb)
+{
+	char	*str;
+
+	str = sb->buf;
+	sb->buf = NULL;
+	sb->len = 0;
+	sb->cap = 0;
+	return (str);
+}
+
+void	ft_sb_free(t_strbuf *sb)
+{
+	ft_safefree((void **)&sb->buf);
+	sb->len = 0;
+	sb->cap = 0;
+}
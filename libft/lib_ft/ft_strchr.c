@@ -16,18 +16,20 @@ character "character" in the string str. The function returns a pointer to the
 matched character or NULL if the character is not found. The terminating null
 byte is considered part of the string, so that if c is specified as '\0', the
 function returns a pointer to the terminator.
+ft_strchr_ref() is the byte-at-a-time reference version. ft_strchr() itself
+resolves to the fastest version the CPU supports, see ft_simd.h.
 */
 
-#include "libft.h"
+#include "ft_simd.h"
 
-char	*ft_strchr(const char *str, int character)
+char	*ft_strchr_ref(const char *str, int character)
 {
 	unsigned char	c;
 
 	c = (unsigned char)character;
 	while (*str != '\0')
 	{
-		if (*str == c)
+		if ((unsigned char)*str == c)
 			return ((char *)str);
 		str++;
 	}
@@ -35,3 +37,18 @@ char	*ft_strchr(const char *str, int character)
 		return ((char *)str);
 	return (NULL);
 }
+
+static FT_NOSAN t_strchr_fn	ft_strchr_resolve(void)
+{
+	int	level;
+
+	level = ft_cpu_level();
+	if (level == FT_CPU_AVX2)
+		return (ft_strchr_avx2);
+	if (level == FT_CPU_SSE2)
+		return (ft_strchr_sse2);
+	return (ft_strchr_swar);
+}
+
+char	*ft_strchr(const char *str, int character)
+	__attribute__((ifunc("ft_strchr_resolve")));
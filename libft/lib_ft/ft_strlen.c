@@ -14,11 +14,13 @@
 The ft_strlen() function calculates the length of the string pointed to by s,
 excluding the terminating null byte ('\0'). The strlen() function returns the
 number of bytes in the string pointed to by s.
+ft_strlen_ref() is the byte-at-a-time reference version. ft_strlen() itself
+resolves to the fastest version the CPU supports, see ft_simd.h.
 */
 
-#include "libft.h"
+#include "ft_simd.h"
 
-size_t	ft_strlen(const char *str)
+size_t	ft_strlen_ref(const char *str)
 {
 	const char	*s;
 
@@ -27,3 +29,18 @@ size_t	ft_strlen(const char *str)
 		s++;
 	return (s - str);
 }
+
+static FT_NOSAN t_strlen_fn	ft_strlen_resolve(void)
+{
+	int	level;
+
+	level = ft_cpu_level();
+	if (level == FT_CPU_AVX2)
+		return (ft_strlen_avx2);
+	if (level == FT_CPU_SSE2)
+		return (ft_strlen_sse2);
+	return (ft_strlen_swar);
+}
+
+size_t	ft_strlen(const char *str)
+	__attribute__((ifunc("ft_strlen_resolve")));
@@ -20,11 +20,13 @@ compared. Upon successful completion, the function returns an integer
 greater than, equal to, or less than 0, if the possibly null-terminated
 array pointed to by str1 is greater than, equal to, or less than the possibly
 null-terminated array pointed to by str2 respectively.
+ft_strncmp_ref() is the byte-at-a-time reference version. ft_strncmp() itself
+resolves to the fastest version the CPU supports, see ft_simd.h.
 */
 
-#include "libft.h"
+#include "ft_simd.h"
 
-int	ft_strncmp(const char *str1, const char *str2, size_t n)
+int	ft_strncmp_ref(const char *str1, const char *str2, size_t n)
 {
 	while (n > 0 && *str1 && *str2)
 	{
@@ -44,3 +46,18 @@ int	ft_strncmp(const char *str1, const char *str2, size_t n)
 	}
 	return (0);
 }
+
+static FT_NOSAN t_strncmp_fn	ft_strncmp_resolve(void)
+{
+	int	level;
+
+	level = ft_cpu_level();
+	if (level == FT_CPU_AVX2)
+		return (ft_strncmp_avx2);
+	if (level == FT_CPU_SSE2)
+		return (ft_strncmp_sse2);
+	return (ft_strncmp_swar);
+}
+
+int	ft_strncmp(const char *str1, const char *str2, size_t n)
+	__attribute__((ifunc("ft_strncmp_resolve")));
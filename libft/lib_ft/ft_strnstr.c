@@ -17,11 +17,14 @@ searched. Characters that appear after a ‘\0’ character are not searched.
 If "find" is an empty string, "pile" is returned; if "find" occurs nowhere
 in "pile", NULL is returned; otherwise a pointer to the first character of
 the first occurrence of "find" is returned.
+ft_strnstr_ref() is the byte-at-a-time reference version. ft_strnstr() only
+looks at the places where the first character of "find" occurs, found with
+ft_memchr(), and compares them with ft_memcmp(), both vectorized.
 */
 
-#include "libft.h"
+#include "ft_simd.h"
 
-char	*ft_strnstr(const char *pile, const char *find, size_t len)
+char	*ft_strnstr_ref(const char *pile, const char *find, size_t len)
 {
 	size_t	findlen;
 	size_t	len1;
@@ -40,3 +43,32 @@ char	*ft_strnstr(const char *pile, const char *find, size_t len)
 	}
 	return (NULL);
 }
+
+char	*ft_strnstr(const char *pile, const char *find, size_t len)
+{
+	size_t		findlen;
+	size_t		pilelen;
+	const char	*cand;
+	const char	*end;
+
+	if (!*find)
+		return ((char *)pile);
+	if (!pile && len == 0)
+		return (NULL);
+	findlen = ft_strlen(find);
+	pilelen = ft_strnlen(pile, len);
+	if (pilelen < findlen)
+		return (NULL);
+	cand = pile;
+	end = pile + pilelen - findlen + 1;
+	while (cand < end)
+	{
+		cand = ft_memchr(cand, *find, end - cand);
+		if (!cand)
+			return (NULL);
+		if (!ft_memcmp(cand, find, findlen))
+			return ((char *)cand);
+		cand++;
+	}
+	return (NULL);
+}
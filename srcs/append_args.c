@@ -6,89 +6,58 @@
 /*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/06 20:53:44 by bleow             #+#    #+#             */
-/*   Updated: 2025/05/29 08:11:09 by bleow            ###   ########.fr       */
+/*   Updated: 2025/06/20 11:26:08 by bleow            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /*
-Copies all arguments from the original node to a newly allocated array.
+Doubles the capacity of a node's args and arg_quote_type vectors.
+- Both vectors live in the node's arena and grow with
+  arena_realloc(), the old ones go with the next arena_reset().
+- Only the pointer arrays are reallocated, the strings and quote
+  arrays they point to are moved over as they are.
+- Both vectors stay NULL terminated.
 Returns:
-- A newly allocated array containing copies of the arguments.
-- NULL on error.
+- 1 on success.
+- 0 on allocation failure (node is left unchanged).
 */
-char	**dup_node_args(t_node *node,	size_t len)
+int	grow_node_args(t_node *node)
 {
 	char	**new_args;
-	size_t	i;
-
-	new_args = malloc(sizeof(char *) * (len + 2));
-	if (!new_args)
-		return (NULL);
-	i = 0;
-	while (i < len)
-	{
-		new_args[i] = ft_strdup(node->args[i]);
-		if (!new_args[i])
-		{
-			ft_free_2d(new_args, i);
-			return (NULL);
-		}
-		i++;
-	}
-	return (new_args);
-}
-
-/*
-Duplicates the entire quote type tracking structure for all arguments.
-This function creates a deep copy of the argument quote type tracking
-structure, maintaining the same quote types for each character of 
-each argument.
-Returns:
-- A newly allocated 2D array of quote types
-- NULL (with proper cleanup of any partial allocations) on error.
-*/
-int	**dup_quote_types(t_node *node, size_t len)
-{
-	size_t	i;
-	size_t	qlen;
 	int		**new_quote_types;
+	int		new_cap;
 
-	new_quote_types = malloc(sizeof(int *) * (len + 2));
+	new_cap = node->arg_cap * 2;
+	if (new_cap < ARGS_MIN_CAP)
+		new_cap = ARGS_MIN_CAP;
+	new_args = arena_realloc(node->arena, node->args,
+			sizeof(char *) * node->arg_cap, sizeof(char *) * new_cap);
+	if (!new_args)
+		return (0);
+	new_quote_types = arena_realloc(node->arena, node->arg_quote_type,
+			sizeof(int *) * node->arg_cap, sizeof(int *) * new_cap);
 	if (!new_quote_types)
-		return (NULL);
-	i = 0;
-	while (i < len)
-	{
-		if (node->arg_quote_type && node->arg_quote_type[i])
-		{
-			qlen = ft_strlen(node->args[i]);
-			new_quote_types[i] = copy_int_arr(node->arg_quote_type[i], qlen);
-			if (!new_quote_types[i])
-			{
-				ft_free_int_2d(new_quote_types, i);
-				return (NULL);
-			}
-		}
-		else
-			new_quote_types[i] = NULL;
-		i++;
-	}
-	return (new_quote_types);
+		return (0);
+	node->args = new_args;
+	node->arg_quote_type = new_quote_types;
+	node->arg_cap = new_cap;
+	return (1);
 }
 
 /*
 Creates a character-level quote type array for a new argument.
 - Single quotes are represented by 4, double quotes by 5.
 - The last element is set to -1 as a guard value.
+- The array comes from the arena of the node it is made for.
 Used to maintain information about what kind of quote (if any) surrounded
 each character in the shell command arguments.
 Returns:
 - Pointer to the new quote_types array on success
 - NULL on failure
 */
-int	*set_char_quote_types(char *arg_text, int quote_type)
+int	*set_char_quote_types(char *arg_text, int quote_type, t_arena *arena)
 {
 	int		*char_quote_types;
 	size_t	len;
@@ -97,7 +66,7 @@ int	*set_char_quote_types(char *arg_text, int quote_type)
 	if (!arg_text)
 		return (NULL);
 	len = ft_strlen(arg_text);
-	char_quote_types = malloc(sizeof(int) * (len + 1));
+	char_quote_types = arena_alloc(arena, sizeof(int) * (len + 1));
 	if (!char_quote_types)
 		return (NULL);
 	i = 0;
@@ -111,42 +80,35 @@ int	*set_char_quote_types(char *arg_text, int quote_type)
 }
 
 /*
-Creates a new quote types array with the new argument's quote type information.
-This function expands the quote types array when adding a new argument.
+Appends an argument to a node, taking ownership of it.
+- new_arg and quote_types are stored as they are, without copying.
+- Grows the vectors geometrically, so building N arguments is O(N).
+- On failure new_arg is freed, quote_types belongs to the arena.
 Returns:
-- A newly allocated 2D array of quote types with the new entry.
-- NULL (with proper cleanup of all related memory) on error.
+- 1 on success.
+- 0 on failure.
+Works with append_arg() and merge_arg_with_cmd().
 */
-int	**resize_quotype_arr(t_node *node, char *new_arg, int quote_type,
-			char **new_args)
+int	append_arg_owned(t_node *node, char *new_arg, int *quote_types)
 {
-	int		**new_quote_types;
-	size_t	len;
-
-	if (!node || !node->args || !new_args)
-		return (NULL);
-	len = ft_arrlen(node->args);
-	new_quote_types = dup_quote_types(node, len);
-	if (!new_quote_types)
+	if (!node || !node->args || !new_arg || !quote_types
+		|| (node->arg_count + 1 >= node->arg_cap && !grow_node_args(node)))
 	{
-		ft_free_2d(new_args, len + 1);
-		return (NULL);
-	}
-	new_quote_types[len] = set_char_quote_types(new_arg, quote_type);
-	if (!new_quote_types[len])
-	{
-		ft_free_int_2d(new_quote_types, len);
-		ft_free_2d(new_args, len + 1);
-		return (NULL);
+		ft_safefree((void **)&new_arg);
+		return (0);
 	}
-	new_quote_types[len + 1] = NULL;
-	return (new_quote_types);
+	node->args[node->arg_count] = new_arg;
+	node->arg_quote_type[node->arg_count] = quote_types;
+	node->arg_count++;
+	node->args[node->arg_count] = NULL;
+	node->arg_quote_type[node->arg_count] = NULL;
+	return (1);
 }
 
 /*
-Appends an argument to a node's argument array
-This function expands both the args and arg_quote_type arrays, adding the
-new argument and its corresponding character-level quote information.
+Appends a copy of an argument to a node's argument array
+Adds the new argument and its corresponding character-level quote
+information, see append_arg_owned() for how the vectors grow.
 Example: 
 String: "Hello"'world'!
 Args: ["Hello", "world"]
@@ -154,29 +116,13 @@ Quote types: [[5, 5, 5, 5, 5], [4, 4, 4, 4]]
 */
 void	append_arg(t_node *node, char *new_arg, int quote_type)
 {
-	char	**new_args;
-	int		**new_quote_types;
-	size_t	len;
+	char	*arg_copy;
 
 	if (!node || !new_arg || !node->args)
 		return ;
-	len = ft_arrlen(node->args);
-	new_args = dup_node_args(node, len);
-	if (!new_args)
-		return ;
-	new_args[len] = ft_strdup(new_arg);
-	if (!new_args[len])
-	{
-		ft_free_2d(new_args, len);
+	arg_copy = ft_strdup(new_arg);
+	if (!arg_copy)
 		return ;
-	}
-	new_args[len + 1] = NULL;
-	new_quote_types = resize_quotype_arr(node, new_arg, quote_type, new_args);
-	if (!new_quote_types)
-		return ;
-	ft_free_2d(node->args, len);
-	if (node->arg_quote_type)
-		ft_free_int_2d(node->arg_quote_type, len);
-	node->args = new_args;
-	node->arg_quote_type = new_quote_types;
+	append_arg_owned(node, arg_copy,
+		set_char_quote_types(new_arg, quote_type, node->arena));
 }
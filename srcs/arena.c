@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/19 14:12:40 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/19 18:03:27 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Rounds a size up to the arena alignment.
+Returns:
+- Size rounded up to a multiple of ARENA_ALIGN.
+*/
+size_t	arena_align(size_t size)
+{
+	return ((size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1));
+}
+
+/*
+Allocates a new chunk and links it right after the current one.
+- Chunks hold at least ARENA_CHUNK_SZ bytes, more for large requests.
+- Chunks that follow are kept for reuse after the next reset.
+Returns:
+- Pointer to the new chunk.
+- NULL on allocation failure.
+*/
+t_arena_chunk	*arena_add_chunk(t_arena *arena, size_t size)
+{
+	t_arena_chunk	*chunk;
+
+	if (size < ARENA_CHUNK_SZ)
+		size = ARENA_CHUNK_SZ;
+	chunk = malloc(arena_align(sizeof(t_arena_chunk)) + size);
+	if (!chunk)
+		return (NULL);
+	chunk->size = size;
+	chunk->used = 0;
+	chunk->next = NULL;
+	if (!arena->head)
+		arena->head = chunk;
+	else
+	{
+		chunk->next = arena->curr->next;
+		arena->curr->next = chunk;
+	}
+	return (chunk);
+}
+
+/*
+Bump-allocates memory from the arena.
+- Moves on to the next retained chunk when the current one is full.
+- Memory is never freed on its own, only by arena_reset().
+Returns:
+- Pointer to aligned, uninitialised memory.
+- NULL on allocation failure.
+Works with initnode().
+*/
+void	*arena_alloc(t_arena *arena, size_t size)
+{
+	t_arena_chunk	*chunk;
+	void			*ptr;
+
+	size = arena_align(size);
+	chunk = arena->curr;
+	if (chunk && chunk->used + size > chunk->size)
+	{
+		chunk = chunk->next;
+		if (chunk)
+			chunk->used = 0;
+	}
+	if (!chunk || chunk->used + size > chunk->size)
+	{
+		chunk = arena_add_chunk(arena, size);
+		if (!chunk)
+			return (NULL);
+	}
+	arena->curr = chunk;
+	ptr = (char *)chunk + arena_align(sizeof(t_arena_chunk)) + chunk->used;
+	chunk->used += size;
+	return (ptr);
+}
+
+/*
+Releases everything allocated from the arena in one go.
+- Rewinds to the first chunk and keeps every chunk for reuse.
+- With ARENA_POISON set, fills all chunks with ARENA_POISON_BYTE
+  so that stale pointers into the last command show up quickly.
+Works with cleanup_token_list().
+*/
+void	arena_reset(t_arena *arena)
+{
+	t_arena_chunk	*chunk;
+
+	if (ARENA_POISON)
+	{
+		chunk = arena->head;
+		while (chunk)
+		{
+			ft_memset((char *)chunk + arena_align(sizeof(t_arena_chunk)),
+				ARENA_POISON_BYTE, chunk->size);
+			chunk = chunk->next;
+		}
+	}
+	arena->curr = arena->head;
+	if (arena->head)
+		arena->head->used = 0;
+}
+
+/*
+Frees every chunk of the arena.
+Works with cleanup_vars().
+*/
+void	arena_destroy(t_arena *arena)
+{
+	t_arena_chunk	*next;
+
+	while (arena->head)
+	{
+		next = arena->head->next;
+		free(arena->head);
+		arena->head = next;
+	}
+	arena->curr = NULL;
+}
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/07/03 11:26:14 by bleow             #+#    #+#             */
+/*   Updated: 2025/07/03 15:02:51 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Grows a block that was allocated from the arena.
+- When the block is the last one handed out from the current chunk
+  and the chunk has room, it is extended where it is.
+- Otherwise a new block is allocated and the old contents copied,
+  the old block is only released by arena_reset().
+Returns:
+- Pointer to a block of at least new_size bytes.
+- NULL on allocation failure (the old block is left as it was).
+Works with grow_node_args() and realloc_quo_arr().
+*/
+void	*arena_realloc(t_arena *arena, void *ptr, size_t old_size,
+			size_t new_size)
+{
+	t_arena_chunk	*chunk;
+	char			*end;
+	void			*new_ptr;
+
+	chunk = arena->curr;
+	old_size = arena_align(old_size);
+	new_size = arena_align(new_size);
+	if (ptr && chunk)
+	{
+		end = (char *)chunk + arena_align(sizeof(t_arena_chunk))
+			+ chunk->used;
+		if ((char *)ptr + old_size == end
+			&& chunk->used - old_size + new_size <= chunk->size)
+		{
+			chunk->used = chunk->used - old_size + new_size;
+			return (ptr);
+		}
+	}
+	new_ptr = arena_alloc(arena, new_size);
+	if (new_ptr && ptr)
+		ft_memcpy(new_ptr, ptr, old_size);
+	return (new_ptr);
+}
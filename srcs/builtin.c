@@ -15,7 +15,8 @@
 /*
 Checks if a command is a shell builtin.
 - Tests command name against all builtin commands.
-- Shell builtins: echo, cd, pwd, export, unset, env, exit.
+- Shell builtins: echo, cd, pwd, export, unset, env, exit, hash,
+  history, shopt.
 Returns:
 1 if command is a builtin.
 0 if command is not a builtin or is NULL.
@@ -35,18 +36,57 @@ int	is_builtin(char *cmd)
 		return (1);
 	if (!ft_strcmp(cmd, "export"))
 		return (1);
+	if (!ft_strcmp(cmd, "hash"))
+		return (1);
+	if (!ft_strcmp(cmd, "history"))
+		return (1);
 	if (!ft_strcmp(cmd, "pwd"))
 		return (1);
+	if (!ft_strcmp(cmd, "shopt"))
+		return (1);
 	if (!ft_strcmp(cmd, "unset"))
 		return (1);
 	return (0);
 }
 
+/*
+Calls the builtin function matching the command name.
+Returns:
+- The exit status from the builtin.
+- 1 if command is invalid (should never happen).
+*/
+static int	dispatch_builtin(char *cmd, char **args, t_vars *vars)
+{
+	if (!ft_strcmp(cmd, "cd"))
+		return (builtin_cd(args, vars));
+	if (!ft_strcmp(cmd, "echo"))
+		return (builtin_echo(args, vars));
+	if (!ft_strcmp(cmd, "env"))
+		return (builtin_env(vars));
+	if (!ft_strcmp(cmd, "exit"))
+		return (builtin_exit(args, vars));
+	if (!ft_strcmp(cmd, "export"))
+		return (builtin_export(args, vars));
+	if (!ft_strcmp(cmd, "hash"))
+		return (builtin_hash(args, vars));
+	if (!ft_strcmp(cmd, "history"))
+		return (builtin_history(args, vars));
+	if (!ft_strcmp(cmd, "pwd"))
+		return (builtin_pwd(vars));
+	if (!ft_strcmp(cmd, "shopt"))
+		return (builtin_shopt(args, vars));
+	if (!ft_strcmp(cmd, "unset"))
+		return (builtin_unset(args, vars));
+	return (1);
+}
+
 /*
 Executes the appropriate builtin command function.
-- Identifies which builtin to call based on command name.
+- Identifies which builtin to call with dispatch_builtin().
 - Passes arguments and environment to the specific builtin.
 - Each builtin handles its own error messages and reporting.
+- Flushes the builtin's buffered output while its redirections are
+  still in place, a failed write turns a success into status 1.
 Returns:
 - The exit status from the executed builtin.
 - 1 if command is invalid (should never happen).
@@ -60,21 +100,9 @@ int	execute_builtin(char *cmd, char **args, t_vars *vars)
 {
 	int	errcode;
 
-	errcode = 0;
-	if (!ft_strcmp(cmd, "cd"))
-		errcode = builtin_cd(args, vars);
-	else if (!ft_strcmp(cmd, "echo"))
-		errcode = builtin_echo(args, vars);
-	else if (!ft_strcmp(cmd, "env"))
-		errcode = builtin_env(vars);
-	else if (!ft_strcmp(cmd, "exit"))
-		errcode = builtin_exit(args, vars);
-	else if (!ft_strcmp(cmd, "export"))
-		errcode = builtin_export(args, vars);
-	else if (!ft_strcmp(cmd, "pwd"))
-		errcode = builtin_pwd(vars);
-	else if (!ft_strcmp(cmd, "unset"))
-		errcode = builtin_unset(args, vars);
+	errcode = dispatch_builtin(cmd, args, vars);
+	if (out_flush_builtin(cmd, &vars->out) && !errcode)
+		errcode = 1;
 	vars->error_code = errcode;
 	return (errcode);
 }
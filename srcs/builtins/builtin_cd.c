@@ -17,7 +17,8 @@ Built-in command: cd. Changes the current working directory.
 - Master control function for cd command.
 - Handles special directories (home and previous).
 - Changes to the directory specified in args[1].
-- Updates PWD and OLDPWD environment variables.
+- Updates PWD and OLDPWD environment variables, OLDPWD taking the
+  value PWD had before the change.
 - Frees memory allocated for oldpwd.
 Returns 0 on success, 1 on failure.
 */
@@ -29,7 +30,7 @@ int	builtin_cd(char **args, t_vars *vars)
 	if (args[1] && args[2])
 		return (1);
 	oldpwd = NULL;
-	oldpwd = get_env_val("OLDPWD", vars->env);
+	oldpwd = get_env_val("PWD", vars);
 	if (!oldpwd)
 		return (1);
 	cmdcode = handle_cd_path(args, vars);
@@ -60,7 +61,7 @@ int	handle_cd_special(char **args, t_vars *vars, char **path_value)
 {
 	if ((!args[1]) || ((args[1][0] == '~') && (args[1][1] == '\0')))
 	{
-		*path_value = get_env_val("HOME", vars->env);
+		*path_value = get_env_val("HOME", vars);
 		if (!(*path_value) || chdir(*path_value) != 0)
 		{
 			printf("cd: HOME not set or no access\n");
@@ -68,7 +69,7 @@ int	handle_cd_special(char **args, t_vars *vars, char **path_value)
 		}
 		return (0);
 	}
-	*path_value = get_env_val("OLDPWD", vars->env);
+	*path_value = get_env_val("OLDPWD", vars);
 	if (!(*path_value) || chdir(*path_value) != 0)
 	{
 		printf("cd: OLDPWD not set or no access\n");
@@ -108,34 +109,12 @@ int	handle_cd_path(char **args, t_vars *vars)
 	return (cmdcode);
 }
 
-/*
-Export a single environment variable using builtin_export.
-Combines key and value, builds argv, and calls builtin_export.
-Returns:
-- 0 on success.
-- 1 on allocation failure.
-*/
-int	export_env_var(t_vars *vars, char *key, char *value)
-{
-	char	*tmp;
-	char	*dummy_argv[3];
-
-	tmp = ft_strjoin(key, value);
-	if (!tmp)
-		return (1);
-	dummy_argv[0] = "export";
-	dummy_argv[1] = tmp;
-	dummy_argv[2] = NULL;
-	builtin_export(dummy_argv, vars);
-	ft_safefree((void **)&tmp);
-	return (0);
-}
-
 /*
 Updates PWD and OLDPWD environment variables after directory change.
-- Temporarily stores the old working directory in OLDPWD.
+- Stores the previous working directory in OLDPWD.
 - Temporarily buffers the current working directory path in cwd[].
 - Updates the PWD environment variable with the new path.
+- Both entries are updated in place, without rebuilding the environment.
 Returns 0 on success, 1 on failure.
 */
 int	update_env_pwd(t_vars *vars, char *oldpwd)
@@ -149,9 +128,9 @@ int	update_env_pwd(t_vars *vars, char *oldpwd)
 		ft_putstr_fd("cd: error retrieving current directory\n", 2);
 		return (1);
 	}
-	if (export_env_var(vars, "OLDPWD=", oldpwd) != 0)
+	if (env_set(vars, "OLDPWD", oldpwd) != 0)
 		return (1);
-	if (export_env_var(vars, "PWD=", cwd) != 0)
+	if (env_set(vars, "PWD", cwd) != 0)
 		return (1);
 	return (0);
 }
@@ -39,7 +39,7 @@ int	builtin_echo(char **args, t_vars *vars)
 		newline = 0;
 		i++;
 	}
-	process_echo_args(args, i, newline);
+	process_echo_args(&vars->out, args, i, newline);
 	vars->error_code = cmdcode;
 	return (cmdcode);
 }
@@ -48,27 +48,23 @@ int	builtin_echo(char **args, t_vars *vars)
 Process and print echo command arguments.
 Adds a space after each argument if there is more than one argument.
 Adds newline if needed.
+Output goes through the builtin output buffer, flushed by
+execute_builtin().
 Returns 0 on success.
 */
-int	process_echo_args(char **args, int start, int nl_flag)
+int	process_echo_args(t_outbuf *out, char **args, int start, int nl_flag)
 {
 	int	i;
-	int	j;
 
 	i = start;
 	while (args[i])
 	{
-		j = 0;
-		while (args[i][j])
-		{
-			write(1, &args[i][j], 1);
-			j++;
-		}
+		out_puts(out, args[i]);
 		if (args[i + 1])
-			write(1, " ", 1);
+			out_write(out, " ", 1);
 		i++;
 	}
 	if (nl_flag)
-		write(1, "\n", 1);
+		out_write(out, "\n", 1);
 	return (0);
 }
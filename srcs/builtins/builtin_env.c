@@ -14,7 +14,7 @@
 
 /*
 Built-in command: env. Prints the environment variables.
-- Prints all environment variables to STDOUT.
+- Prints all environment variables to STDOUT through the output buffer.
 Returns 0 on success. Returns 1 on failure.
 */
 int	builtin_env(t_vars *vars)
@@ -31,7 +31,8 @@ int	builtin_env(t_vars *vars)
 	}
 	while (vars->env[i])
 	{
-		printf("%s\n", vars->env[i]);
+		out_puts(&vars->out, vars->env[i]);
+		out_write(&vars->out, "\n", 1);
 		i++;
 	}
 	vars->error_code = cmdcode;
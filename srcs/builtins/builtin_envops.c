@@ -31,7 +31,6 @@ t_envop	*make_envop_node(const char *arg, int flag)
 	node->export_key = NULL;
 	node->flag = flag;
 	node->arg_len = 0;
-	node->matched_idx = -1;
 	node->next = NULL;
 	if (node->arg_str)
 		node->export_key = get_env_key(node->arg_str, &node->arg_len);
@@ -93,67 +92,31 @@ void	add_envop_node(t_envop **head, t_envop *node)
 }
 
 /*
-Match each t_envop node to an environment variable.
-- Sets matched_idx if found.
-- Updates flag if assignment is present.
-*/
-void	match_envline_to_env(t_envop *envop_list, char **env)
-{
-	t_envop	*node;
-	int		i;
-
-	node = envop_list;
-	while (node)
-	{
-		node->matched_idx = -1;
-		i = 0;
-		while (env && env[i])
-		{
-			if ((ft_memcmp(env[i], node->export_key, node->arg_len) == 0)
-				&& (env[i][node->arg_len] == '='
-				|| env[i][node->arg_len] == '\0'))
-			{
-				node->matched_idx = i;
-				if (node->flag == 1 && ft_strchr(node->arg_str, '='))
-					node->flag = 0;
-				break ;
-			}
-			i++;
-		}
-		node = node->next;
-	}
-}
-
-/*
-Process envop list and environment to produce a new environment array.
-- Applies export operations.
-- Adds new variables if needed.
+Apply a parsed export/unset list to the environment in place.
+- Export nodes hand their "KEY=VALUE" string over to env_set_line().
+- Unset nodes remove their key with env_unset().
 Returns:
-- A new environment array.
-- NULL on failure.
+- 0 on success.
+- 1 if any update failed.
 */
-char	**proc_envop_list(t_envop *envop_list, char **env)
+int	apply_envop_list(t_envop *envop_list, t_vars *vars)
 {
-	int		env_arr_len;
-	int		env_arr_idx;
-	char	**new_env;
 	t_envop	*node;
+	int		status;
 
-	env_arr_len = calc_new_env_len(envop_list, ft_arrlen(env));
-	new_env = malloc(sizeof(char *) * (env_arr_len + 1));
-	if (!new_env)
-		return (NULL);
-	env_arr_idx = copy_env_with_ops(env, envop_list, new_env);
+	status = 0;
 	node = envop_list;
 	while (node)
 	{
-		if (node->flag == 1 && node->matched_idx == -1)
+		if (node->flag == 1)
 		{
-			if (env_arr_idx < env_arr_len)
-				new_env[env_arr_idx++] = ft_strdup(node->arg_str);
+			if (env_set_line(vars, node->arg_str) != 0)
+				status = 1;
+			node->arg_str = NULL;
 		}
+		else
+			env_unset(vars, node->export_key);
 		node = node->next;
 	}
-	new_env[env_arr_idx] = NULL;
-	return (new_env);
+	return (status);
 }
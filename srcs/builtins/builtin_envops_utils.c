@@ -66,63 +66,3 @@ void	err_invalid_export_arg(char *arg)
 	ft_putstr_fd(arg, 2);
 	ft_putstr_fd("': not a valid identifier\n", 2);
 }
-
-/*
-Copy environment variables into a new array, applying envop list changes.
-- Overwrites or copies as needed.
-Returns the number of entries copied.
-*/
-int	copy_env_with_envop_list(char **env, t_envop *envop_list, char **new_env)
-{
-	int		i;
-	int		j;
-	int		action;
-	t_envop	*overwrite_node;
-
-	i = 0;
-	j = 0;
-	while (env && env[i])
-	{
-		overwrite_node = NULL;
-		action = chk_copy_or_write(i, envop_list, &overwrite_node);
-		if (action == 0)
-			new_env[j++] = ft_strdup(overwrite_node->arg_str);
-		else if (action == 1)
-			new_env[j++] = ft_strdup(env[i]);
-		i++;
-	}
-	return (j);
-}
-
-/*
-Copy environment variables into a new array, applying export operations.
-- Overwrites or copies as needed.
-Returns the number of entries copied.
-*/
-int	copy_env_with_ops(char **env, t_envop *env_list, char **new_env)
-{
-	int		i;
-	int		j;
-	int		action;
-	t_envop	*overwrite_node;
-
-	i = 0;
-	j = 0;
-	while (env && env[i])
-	{
-		overwrite_node = NULL;
-		action = decide_action_at_index(i, env_list, &overwrite_node);
-		if (action == 0)
-		{
-			new_env[j] = ft_strdup(overwrite_node->arg_str);
-			j++;
-		}
-		else if (action == 1)
-		{
-			new_env[j] = ft_strdup(env[i]);
-			j++;
-		}
-		i++;
-	}
-	return (j);
-}
@@ -15,7 +15,7 @@
 /*
 Built-in command: exit. Exits the shell.
 - Initializes cmdcode to 0 then updates it with the last command code.
-- Prints "exit" to STDOUT.
+- Prints "exit" to STDOUT when the shell is interactive.
 - Saves history to HISTORY_FILE.
 - Clears readline history.
 - Calls cleanup_exit() to free all allocated memory.
@@ -72,7 +72,8 @@ int	builtin_exit(char **args, t_vars *vars)
 	{
 		tcsetattr(STDIN_FILENO, TCSANOW, &vars->ori_term_settings);
 	}
-	ft_putendl_fd("exit", STDOUT_FILENO);
+	if (vars->interactive)
+		ft_putendl_fd("exit", STDOUT_FILENO);
 	cleanup_exit(vars);
 	exit(cmdcode);
 	return (0);
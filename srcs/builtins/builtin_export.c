@@ -22,8 +22,7 @@ Returns 0 on success, 1 on failure.
 int	builtin_export(char **args, t_vars *vars)
 {
 	t_envop	*to_proc;
-	char	**new_env;
-	int		old_len;
+	int		status;
 
 	if (!vars || !vars->env)
 		return (vars->error_code = 1);
@@ -32,16 +31,10 @@ int	builtin_export(char **args, t_vars *vars)
 	to_proc = parse_envop_list(args, 1);
 	if (!to_proc)
 		return (vars->error_code = 1);
-	match_envline_to_env(to_proc, vars->env);
-	new_env = proc_envop_list(to_proc, vars->env);
-	if (new_env)
-	{
-		old_len = ft_arrlen(vars->env);
-		ft_free_2d(vars->env, old_len);
-		vars->env = new_env;
-	}
+	status = apply_envop_list(to_proc, vars);
+	chk_path_change(to_proc, vars);
 	free_envop_list(&to_proc);
-	return (vars->error_code = 0);
+	return (vars->error_code = status);
 }
 
 /*
@@ -81,7 +74,7 @@ int	sort_env(int count, t_vars *vars)
 	cmdcode = 0;
 	while (sort_env[i])
 	{
-		cmdcode = process_export_var(sort_env[i]);
+		cmdcode = process_export_var(&vars->out, sort_env[i]);
 		i++;
 	}
 	i = 0;
@@ -101,7 +94,7 @@ Master control function to process and print a single environment variable.
 - If it doesn't have a value, prints the variable only.
 Returns 0 on success.
 */
-int	process_export_var(char *env_var)
+int	process_export_var(t_outbuf *out, char *env_var)
 {
 	char	*equal_pos;
 
@@ -109,12 +102,14 @@ int	process_export_var(char *env_var)
 	if (equal_pos)
 	{
 		*equal_pos = '\0';
-		process_var_with_val(env_var, equal_pos + 1);
+		process_var_with_val(out, env_var, equal_pos + 1);
 		*equal_pos = '=';
 	}
 	else
 	{
-		printf("declare -x %s\n", env_var);
+		out_puts(out, "declare -x ");
+		out_puts(out, env_var);
+		out_write(out, "\n", 1);
 	}
 	return (0);
 }
@@ -122,20 +117,26 @@ int	process_export_var(char *env_var)
 /*
 Process and print a variable with a value (has equals sign).
 - Prints the variable name and value in export format.
+- Writes the value in runs up to each double quote, which is escaped.
 Example: "declare -x VAR_NAME="VALUE"
 Returns 0 on success.
 */
-int	process_var_with_val(char *name, char *value)
+int	process_var_with_val(t_outbuf *out, char *name, char *value)
 {
-	printf("declare -x %s=\"", name);
-	while (*value)
+	char	*quote;
+
+	out_puts(out, "declare -x ");
+	out_puts(out, name);
+	out_write(out, "=\"", 2);
+	quote = ft_strchr(value, '"');
+	while (quote)
 	{
-		if (*value == '"')
-			printf("\\\"");
-		else
-			printf("%c", *value);
-		value++;
+		out_write(out, value, quote - value);
+		out_write(out, "\\\"", 2);
+		value = quote + 1;
+		quote = ft_strchr(value, '"');
 	}
-	printf("\"\n");
+	out_puts(out, value);
+	out_write(out, "\"\n", 2);
 	return (0);
 }
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_hash.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/16 13:31:08 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/16 15:47:09 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Built-in command: hash. Manages the command hash table.
+- With no arguments, lists the hashed commands.
+- "-r" forgets every hashed command.
+- Each name argument is looked up in PATH and added to the table.
+Example: hash -r ls cat
+Returns 0 on success, 1 if a name is not found, 2 on bad option.
+*/
+int	builtin_hash(char **args, t_vars *vars)
+{
+	int	i;
+	int	cmdcode;
+
+	if (!args[1])
+		return (vars->error_code = hash_print_table(vars));
+	i = 1;
+	while (args[i] && args[i][0] == '-' && args[i][1])
+	{
+		if (ft_strcmp(args[i++], "--") == 0)
+			break ;
+		if (ft_strcmp(args[i - 1], "-r") != 0)
+			return (vars->error_code = hash_invalid_opt(args[i - 1]));
+		cmd_hash_clear(vars);
+	}
+	cmdcode = 0;
+	while (args[i])
+	{
+		if (!hash_add_cmd(args[i], vars))
+			cmdcode = 1;
+		i++;
+	}
+	return (vars->error_code = cmdcode);
+}
+
+/*
+Prints the hashed commands in "hits<TAB>command" form.
+- Commands cached as not found are not listed.
+Returns 0.
+*/
+int	hash_print_table(t_vars *vars)
+{
+	t_cmdhash	*entry;
+	int			printed;
+	int			i;
+
+	printed = 0;
+	i = 0;
+	while (i < CMD_HASH_SIZE)
+	{
+		entry = vars->cmd_hash[i];
+		while (entry)
+		{
+			if (entry->path)
+			{
+				if (!printed)
+					printf("hits\tcommand\n");
+				printf("%4d\t%s\n", entry->hits, entry->path);
+				printed = 1;
+			}
+			entry = entry->next;
+		}
+		i++;
+	}
+	if (!printed)
+		printf("hash: hash table empty\n");
+	return (0);
+}
+
+/*
+Looks up a command in PATH and stores it in the hash table.
+- Names containing a slash and builtins are not hashed.
+Returns:
+- 1 on success.
+- 0 if the command is not found.
+*/
+int	hash_add_cmd(char *name, t_vars *vars)
+{
+	char	**paths;
+	char	*path;
+
+	if (ft_strchr(name, '/') || is_builtin(name))
+		return (1);
+	path = NULL;
+	paths = get_path_env(vars->env);
+	if (paths)
+		path = search_path_dirs(name, paths);
+	if (!path)
+	{
+		ft_putstr_fd("bleshell: hash: ", 2);
+		ft_putstr_fd(name, 2);
+		ft_putendl_fd(": not found", 2);
+		return (0);
+	}
+	cmd_hash_store(vars, name, path);
+	ft_safefree((void **)&path);
+	return (1);
+}
+
+/*
+Reports an unsupported option given to the hash builtin.
+Returns 2 (usage error).
+*/
+int	hash_invalid_opt(char *opt)
+{
+	ft_putstr_fd("bleshell: hash: ", 2);
+	ft_putstr_fd(opt, 2);
+	ft_putendl_fd(": invalid option", 2);
+	ft_putendl_fd("hash: usage: hash [-r] [name ...]", 2);
+	return (2);
+}
+
+/*
+Drops the command hash table if an export/unset touched PATH.
+Every cached lookup depends on the old PATH value.
+Works with builtin_export() and builtin_unset().
+*/
+void	chk_path_change(t_envop *envop_list, t_vars *vars)
+{
+	while (envop_list)
+	{
+		if (envop_list->export_key
+			&& ft_strcmp(envop_list->export_key, "PATH") == 0)
+		{
+			cmd_hash_clear(vars);
+			return ;
+		}
+		envop_list = envop_list->next;
+	}
+}
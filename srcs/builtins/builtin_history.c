@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_history.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/26 10:14:02 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/26 18:37:45 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Built-in command: history. Lists or searches the command history.
+- With no arguments, lists the history kept in memory.
+- "search PATTERN" lists every distinct entry of the history file
+  and this session that contains PATTERN, using the search index.
+Example: history search make
+Returns 0 on success, 1 if nothing matches, 2 on bad usage.
+*/
+int	builtin_history(char **args, t_vars *vars)
+{
+	if (!args[1])
+		return (history_print_list());
+	if (ft_strcmp(args[1], "search") != 0 || !args[2] || args[3])
+		return (history_usage(args[1]));
+	if (!hist_index_load(&vars->hist_idx))
+		return (1);
+	return (history_print_matches(&vars->hist_idx, args[2]));
+}
+
+/*
+Prints readline's in-memory history as "number  line".
+Returns 0.
+*/
+int	history_print_list(void)
+{
+	HIST_ENTRY	**list;
+	int			i;
+
+	list = history_list();
+	i = 0;
+	while (list && list[i])
+	{
+		printf("%5d  %s\n", history_base + i, list[i]->line);
+		i++;
+	}
+	return (0);
+}
+
+/*
+Prints the index entries containing query as "seq  line".
+- Entries come in order of first use, seq tells when each was
+  last used.
+Returns 0 if anything matched, 1 otherwise.
+*/
+int	history_print_matches(t_histidx *idx, char *query)
+{
+	t_postings	*list;
+	int			count;
+	int			found;
+	int			id;
+	int			i;
+
+	list = shortest_postings(idx, query);
+	count = idx->count;
+	if (list)
+		count = list->count;
+	found = 0;
+	i = 0;
+	while (i < count)
+	{
+		id = i;
+		if (list)
+			id = list->ids[i];
+		if (hist_pick(idx, id, query, INT_MAX))
+		{
+			printf("%5d  %s\n", idx->seq[id] + 1, idx->entries[id]);
+			found = 1;
+		}
+		i++;
+	}
+	return (!found);
+}
+
+/*
+Reports a bad history invocation.
+Returns 2.
+*/
+int	history_usage(char *arg)
+{
+	ft_putstr_fd("bleshell: history: ", 2);
+	ft_putstr_fd(arg, 2);
+	ft_putendl_fd(": invalid usage", 2);
+	ft_putendl_fd("history: usage: history [search pattern]", 2);
+	return (2);
+}
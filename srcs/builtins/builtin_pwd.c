@@ -30,7 +30,8 @@ int	builtin_pwd(t_vars *vars)
 	}
 	else
 	{
-		ft_putendl_fd(pwd, STDOUT_FILENO);
+		out_puts(&vars->out, pwd);
+		out_write(&vars->out, "\n", 1);
 		ft_safefree((void **)&pwd);
 	}
 	vars->error_code = cmdcode;
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_shopt.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/21 10:04:12 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/21 12:37:45 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Built-in command: shopt. Sets, unsets and shows the shell options.
+- "-s" sets and "-u" unsets the named options.
+- Without an action, each named option is shown with its state.
+- Without names, all options are listed, filtered by -s or -u.
+- The only option is "lastpipe", which runs a builtin in the last
+  stage of a pipeline in the shell itself.
+Example: shopt -s lastpipe
+Returns 0 on success, 1 on a bad or unset option name, 2 on bad option.
+*/
+int	builtin_shopt(char **args, t_vars *vars)
+{
+	int	action;
+	int	cmdcode;
+	int	i;
+
+	action = SHOPT_QUERY;
+	i = 1;
+	while (args[i] && args[i][0] == '-' && args[i][1])
+	{
+		if (ft_strcmp(args[i++], "--") == 0)
+			break ;
+		if (ft_strcmp(args[i - 1], "-s") == 0)
+			action = SHOPT_SET;
+		else if (ft_strcmp(args[i - 1], "-u") == 0)
+			action = SHOPT_UNSET;
+		else
+			return (vars->error_code = shopt_invalid_opt(args[i - 1]));
+	}
+	if (!args[i])
+		shopt_show(&vars->out, "lastpipe", vars->lastpipe, action);
+	cmdcode = 0;
+	while (args[i])
+		cmdcode |= shopt_apply(args[i++], action, vars);
+	return (vars->error_code = cmdcode);
+}
+
+/*
+Looks up a shell option by name.
+Returns:
+- Pointer to the flag that holds the option.
+- NULL if there is no such option.
+*/
+int	*shopt_flag(char *name, t_vars *vars)
+{
+	if (ft_strcmp(name, "lastpipe") == 0)
+		return (&vars->lastpipe);
+	return (NULL);
+}
+
+/*
+Applies the shopt action to one named option.
+- SHOPT_QUERY shows the option and its state.
+Returns:
+- 0 on success, or when a queried option is set.
+- 1 if the name is not an option or a queried option is unset.
+*/
+int	shopt_apply(char *name, int action, t_vars *vars)
+{
+	int	*flag;
+
+	flag = shopt_flag(name, vars);
+	if (!flag)
+	{
+		ft_putstr_fd("bleshell: shopt: ", 2);
+		ft_putstr_fd(name, 2);
+		ft_putendl_fd(": invalid shell option name", 2);
+		return (1);
+	}
+	if (action == SHOPT_SET)
+		*flag = 1;
+	else if (action == SHOPT_UNSET)
+		*flag = 0;
+	else
+	{
+		shopt_show(&vars->out, name, *flag, action);
+		return (!*flag);
+	}
+	return (0);
+}
+
+/*
+Writes one option in "name<TAB>on|off" form.
+- With SHOPT_SET only set options are written, with SHOPT_UNSET only
+  unset ones.
+*/
+void	shopt_show(t_outbuf *out, char *name, int on, int action)
+{
+	if ((action == SHOPT_SET && !on) || (action == SHOPT_UNSET && on))
+		return ;
+	out_puts(out, name);
+	if (on)
+		out_puts(out, "\ton\n");
+	else
+		out_puts(out, "\toff\n");
+}
+
+/*
+Reports an unsupported option given to the shopt builtin.
+Returns 2 (usage error).
+*/
+int	shopt_invalid_opt(char *opt)
+{
+	ft_putstr_fd("bleshell: shopt: ", 2);
+	ft_putstr_fd(opt, 2);
+	ft_putendl_fd(": invalid option", 2);
+	ft_putendl_fd("shopt: usage: shopt [-su] [optname ...]", 2);
+	return (2);
+}
@@ -20,8 +20,7 @@
 int	builtin_unset(char **args, t_vars *vars)
 {
 	t_envop	*to_proc;
-	char	**new_env;
-	int		old_len;
+	int		status;
 
 	to_proc = NULL;
 	if ((!vars || !vars->env) && (vars != NULL))
@@ -31,39 +30,21 @@ int	builtin_unset(char **args, t_vars *vars)
 	to_proc = parse_envop_list(args, -1);
 	if (!to_proc)
 		return (vars->error_code = 1);
-	match_envline_to_env(to_proc, vars->env);
-	new_env = proc_envop_list(to_proc, vars->env);
-	if (new_env)
-	{
-		old_len = ft_arrlen(vars->env);
-		ft_free_2d(vars->env, old_len);
-		vars->env = new_env;
-	}
+	status = apply_envop_list(to_proc, vars);
+	chk_path_change(to_proc, vars);
 	free_envop_list(&to_proc);
-	return (vars->error_code = 0);
+	return (vars->error_code = status);
 }
 
 /*
 Find the position of an environment variable in the environment array.
-Returns the position if found, or the end of array (count of elements)
-if not found.
-Returns -1 on NULL input for key or env.
+Uses the environment hash index instead of scanning the array.
+Returns the position if found, or -1 if the variable is not set
+or on NULL input.
 */
-int	get_env_pos(char *key, char **env, int keylen)
+int	get_env_pos(char *key, int keylen, t_vars *vars)
 {
-	int	envpos;
-
-	if (!key || !env)
+	if (!key || !vars->env)
 		return (-1);
-	envpos = 0;
-	while (env[envpos])
-	{
-		if (ft_strncmp(env[envpos], key, keylen) == 0)
-		{
-			if (env[envpos][keylen] == '=' || env[envpos][keylen] == '\0')
-				return (envpos);
-		}
-		envpos++;
-	}
-	return (envpos);
+	return (env_index_find(vars, key, keylen));
 }
@@ -52,6 +52,7 @@ void	cleanup_pipes(t_pipe *pipes)
 		ft_safefree((void **)&pipes->heredoc_delim);
 		pipes->heredoc_delim = NULL;
 	}
+	ft_sb_free(&pipes->hd_buf);
 	if (pipes->redir_fd > 2)
 		close(pipes->redir_fd);
 	ft_safefree((void **)&pipes);
@@ -62,6 +63,9 @@ Cleans up the vars structure.
 - If exists:
 	- Frees pipes structure and it's contents
 	- Frees env array
+	- Empties the command hash table
+	- Frees the environment hash index and envp snapshot
+	- Releases the script or stdin input
 Works with cleanup_exit().
 */
 void	cleanup_vars(t_vars *vars)
@@ -73,6 +77,12 @@ void	cleanup_vars(t_vars *vars)
 	if (vars->pipes)
 		cleanup_pipes(vars->pipes);
 	vars->pipes = NULL;
+	cmd_hash_clear(vars);
+	ft_safefree((void **)&vars->env_idx);
+	ft_safefree((void **)&vars->envp);
+	arena_destroy(&vars->arena);
+	hist_index_free(&vars->hist_idx);
+	close_input(vars);
 	if (vars->env)
 	{
 		env_count = ft_arrlen(vars->env);
@@ -83,7 +93,8 @@ void	cleanup_vars(t_vars *vars)
 
 /*
 Performs complete program cleanup before exit.
-- Saves command history to persistent storage
+- Stops the history writer once every queued command is on disk
+- Writes out any buffered builtin output
 - Cleans up token list and AST structures
 - Frees all vars,pipes, and env memory
 - Clears readline history from memory
@@ -93,11 +104,12 @@ void	cleanup_exit(t_vars *vars)
 {
 	if (!vars)
 		return ;
+	hist_writer_stop(&vars->hist_wr);
+	out_flush(&vars->out);
 	if (isatty(STDIN_FILENO) && vars->ori_term_saved)
 	{
 		tcsetattr(STDIN_FILENO, TCSANOW, &vars->ori_term_settings);
 	}
-	save_history();
 	if (vars->head)
 	{
 		free_null_token_stop(vars);
@@ -118,8 +130,10 @@ void	cleanup_exit(t_vars *vars)
 /*
 Clean up the token list by freeing all nodes.
 - Traverses the linked list of tokens.
-- Frees each node and its arguments.
+- Frees the arguments of each node.
 - Resets head and current pointers in vars.
+- Resets the node arena, which releases every node of the command
+  at once, including nodes that never made it into the list.
 - Called when processing a new command line.
 Works with cleanup_exit().
 */
@@ -128,7 +142,7 @@ void	cleanup_token_list(t_vars *vars)
 	t_node	*current;
 	t_node	*next;
 
-	if (!vars || !vars->head)
+	if (!vars)
 		return ;
 	current = vars->head;
 	while (current)
@@ -139,4 +153,6 @@ void	cleanup_token_list(t_vars *vars)
 	}
 	vars->head = NULL;
 	vars->current = NULL;
+	vars->astroot = NULL;
+	arena_reset(&vars->arena);
 }
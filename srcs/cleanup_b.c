@@ -13,28 +13,26 @@
 #include "../includes/minishell.h"
 
 /*
-Free a single token node and its arguments.
-- Takes a node pointer and frees its arguments array.
-- Properly frees character-level quote type arrays.
-- Then frees the node itself.
+Free the arguments of a single token node.
+- Takes a node pointer and frees its argument strings.
+- The args and quote type arrays belong to the arena and go with
+  the next arena_reset().
+- Closes the heredoc store of a heredoc node.
+- Clears the links, the node memory itself belongs to the arena.
 Works with cleanup_token_list(), build_token_linklist(), maketoken().
 */
 void	free_token_node(t_node *node)
 {
-	size_t	arg_count;
+	int	i;
 
 	if (!node)
 		return ;
-	arg_count = 0;
-	if (node->args)
-		arg_count = ft_arrlen(node->args);
-	if (node->args)
-		ft_free_2d(node->args, arg_count);
-	if (node->arg_quote_type)
-	{
-		ft_free_int_2d(node->arg_quote_type, arg_count);
-		node->arg_quote_type = NULL;
-	}
+	i = 0;
+	while (node->args && node->args[i])
+		ft_safefree((void **)&node->args[i++]);
+	if (node->hd_fd >= 0)
+		close(node->hd_fd);
+	node->hd_fd = -1;
 	node->args = NULL;
 	node->arg_quote_type = NULL;
 	node->next = NULL;
@@ -42,7 +40,6 @@ void	free_token_node(t_node *node)
 	node->left = NULL;
 	node->right = NULL;
 	node->redir = NULL;
-	ft_safefree((void **)&node);
 }
 
 void	free_null_token_stop(t_vars *vars)
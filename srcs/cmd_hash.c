@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_hash.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/16 10:12:55 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/16 15:47:09 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Computes the bucket of a command name in the command hash table.
+Uses the djb2 string hash.
+Returns:
+- Bucket index in the range [0, CMD_HASH_SIZE).
+*/
+int	cmd_hash_key(const char *name)
+{
+	unsigned int	hash;
+
+	hash = 5381;
+	while (*name)
+	{
+		hash = ((hash << 5) + hash) + (unsigned char)*name;
+		name++;
+	}
+	return ((int)(hash % CMD_HASH_SIZE));
+}
+
+/*
+Looks up a command name in the command hash table.
+Returns:
+- Matching entry. Its path is NULL for a cached "not found".
+- NULL if the command has not been hashed yet.
+*/
+t_cmdhash	*cmd_hash_find(t_vars *vars, const char *name)
+{
+	t_cmdhash	*entry;
+
+	entry = vars->cmd_hash[cmd_hash_key(name)];
+	while (entry)
+	{
+		if (ft_strcmp(entry->name, name) == 0)
+			return (entry);
+		entry = entry->next;
+	}
+	return (NULL);
+}
+
+/*
+Creates an empty entry for a command name and links it into its bucket.
+Returns:
+- The new entry.
+- NULL on allocation failure.
+*/
+t_cmdhash	*cmd_hash_new(t_vars *vars, const char *name)
+{
+	t_cmdhash	*entry;
+	int			key;
+
+	entry = (t_cmdhash *)ft_calloc(1, sizeof(t_cmdhash));
+	if (!entry)
+		return (NULL);
+	entry->name = ft_strdup(name);
+	if (!entry->name)
+	{
+		ft_safefree((void **)&entry);
+		return (NULL);
+	}
+	key = cmd_hash_key(name);
+	entry->next = vars->cmd_hash[key];
+	vars->cmd_hash[key] = entry;
+	return (entry);
+}
+
+/*
+Records the resolved path of a command in the command hash table.
+- Replaces the path of an existing entry and resets its hit count.
+- A NULL path caches the command as not found.
+Returns:
+- The stored entry.
+- NULL on allocation failure (the lookup simply isn't cached).
+*/
+t_cmdhash	*cmd_hash_store(t_vars *vars, const char *name, const char *path)
+{
+	t_cmdhash	*entry;
+	char		*path_copy;
+
+	path_copy = NULL;
+	if (path)
+	{
+		path_copy = ft_strdup(path);
+		if (!path_copy)
+			return (NULL);
+	}
+	entry = cmd_hash_find(vars, name);
+	if (!entry)
+		entry = cmd_hash_new(vars, name);
+	if (!entry)
+	{
+		ft_safefree((void **)&path_copy);
+		return (NULL);
+	}
+	ft_safefree((void **)&entry->path);
+	entry->path = path_copy;
+	entry->hits = 0;
+	return (entry);
+}
+
+/*
+Empties the command hash table.
+Called by "hash -r", when PATH changes and at shell exit.
+*/
+void	cmd_hash_clear(t_vars *vars)
+{
+	t_cmdhash	*entry;
+	t_cmdhash	*next;
+	int			i;
+
+	i = 0;
+	while (i < CMD_HASH_SIZE)
+	{
+		entry = vars->cmd_hash[i];
+		while (entry)
+		{
+			next = entry->next;
+			ft_safefree((void **)&entry->name);
+			ft_safefree((void **)&entry->path);
+			ft_safefree((void **)&entry);
+			entry = next;
+		}
+		vars->cmd_hash[i] = NULL;
+		i++;
+	}
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_index.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/17 09:41:26 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/17 16:22:51 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Hashes the first len characters of a variable name (FNV-1a).
+Returns:
+- Non-negative hash value, to be masked with the index capacity.
+*/
+int	env_hash(const char *name, int len)
+{
+	unsigned int	hash;
+	int				i;
+
+	hash = 2166136261u;
+	i = 0;
+	while (i < len)
+	{
+		hash ^= (unsigned char)name[i];
+		hash *= 16777619u;
+		i++;
+	}
+	return ((int)(hash & 0x7fffffff));
+}
+
+/*
+Gets the length of the name part of an environment line.
+Example: "HOME=/root" -> 4, "FOO" -> 3
+*/
+int	env_key_len(const char *line)
+{
+	int	len;
+
+	len = 0;
+	while (line[len] && line[len] != '=')
+		len++;
+	return (len);
+}
+
+/*
+Finds a variable in the environment through the hash index.
+- Probes the open-addressing table from the name's home slot.
+- Slots hold positions in vars->env, -1 marks an empty slot.
+Returns:
+- Position of the variable in vars->env.
+- (-1) if the variable is not set.
+*/
+int	env_index_find(t_vars *vars, const char *name, int len)
+{
+	int		slot;
+	int		pos;
+	char	*line;
+
+	if (!vars->env_idx || !name)
+		return (-1);
+	slot = env_hash(name, len) & (vars->env_idx_cap - 1);
+	while (vars->env_idx[slot] != -1)
+	{
+		pos = vars->env_idx[slot];
+		line = vars->env[pos];
+		if (ft_strncmp(line, name, len) == 0
+			&& (line[len] == '=' || line[len] == '\0'))
+			return (pos);
+		slot = (slot + 1) & (vars->env_idx_cap - 1);
+	}
+	return (-1);
+}
+
+/*
+Adds the environment line at env_pos to the hash index.
+- When a name appears twice, the first line keeps the slot, the same
+  one a linear scan of the array would find.
+*/
+void	env_index_insert(t_vars *vars, int env_pos)
+{
+	int		slot;
+	int		len;
+	char	*line;
+
+	line = vars->env[env_pos];
+	len = env_key_len(line);
+	slot = env_hash(line, len) & (vars->env_idx_cap - 1);
+	while (vars->env_idx[slot] != -1)
+	{
+		if (ft_strncmp(vars->env[vars->env_idx[slot]], line, len) == 0
+			&& (vars->env[vars->env_idx[slot]][len] == '='
+			|| vars->env[vars->env_idx[slot]][len] == '\0'))
+			return ;
+		slot = (slot + 1) & (vars->env_idx_cap - 1);
+	}
+	vars->env_idx[slot] = env_pos;
+}
+
+/*
+Rebuilds the hash index of vars->env from scratch.
+- Sizes the table to a power of two at least twice the variable count.
+- Must be called whenever vars->env is replaced.
+Returns:
+- 1 on success.
+- 0 on allocation failure (lookups then report every variable unset).
+*/
+int	build_env_index(t_vars *vars)
+{
+	int	count;
+	int	i;
+
+	ft_safefree((void **)&vars->env_idx);
+	vars->env_idx_cap = ENV_IDX_MIN;
+	count = vars->env_len;
+	while (vars->env_idx_cap < count * 2)
+		vars->env_idx_cap *= 2;
+	vars->env_idx = (int *)malloc(sizeof(int) * vars->env_idx_cap);
+	if (!vars->env_idx)
+		return (0);
+	i = 0;
+	while (i < vars->env_idx_cap)
+		vars->env_idx[i++] = -1;
+	i = 0;
+	while (i < count)
+		env_index_insert(vars, i++);
+	return (1);
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_store.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/18 10:05:13 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/18 17:39:44 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Appends a line to the environment array, taking ownership of it.
+- Grows the array geometrically when it is full.
+- Adds the new line to the hash index and bumps the generation.
+Returns:
+- 0 on success.
+- 1 on allocation failure (line is freed).
+*/
+int	env_append(t_vars *vars, char *line)
+{
+	char	**new_env;
+
+	if (vars->env_len + 1 >= vars->env_cap)
+	{
+		new_env = (char **)malloc(sizeof(char *) * (vars->env_cap * 2 + 16));
+		if (!new_env)
+		{
+			ft_safefree((void **)&line);
+			return (1);
+		}
+		ft_memcpy(new_env, vars->env, sizeof(char *) * vars->env_len);
+		ft_safefree((void **)&vars->env);
+		vars->env = new_env;
+		vars->env_cap = vars->env_cap * 2 + 16;
+	}
+	vars->env[vars->env_len++] = line;
+	vars->env[vars->env_len] = NULL;
+	if (vars->env_len * 2 > vars->env_idx_cap)
+		build_env_index(vars);
+	else
+		env_index_insert(vars, vars->env_len - 1);
+	vars->env_gen++;
+	return (0);
+}
+
+/*
+Stores a "KEY=VALUE" or bare "KEY" line, taking ownership of it.
+- Replaces an existing entry in place.
+- A bare "KEY" never overwrites a variable that already exists.
+- New variables are appended with env_append().
+Returns:
+- 0 on success.
+- 1 on failure.
+*/
+int	env_set_line(t_vars *vars, char *line)
+{
+	int	len;
+	int	pos;
+
+	if (!line)
+		return (1);
+	len = env_key_len(line);
+	pos = env_index_find(vars, line, len);
+	if (pos == -1)
+		return (env_append(vars, line));
+	if (line[len] != '=')
+	{
+		ft_safefree((void **)&line);
+		return (0);
+	}
+	ft_safefree((void **)&vars->env[pos]);
+	vars->env[pos] = line;
+	vars->env_gen++;
+	return (0);
+}
+
+/*
+Sets an environment variable from a key and a value.
+Builds the "KEY=VALUE" line in a single allocation.
+Example: env_set(vars, "PWD", "/tmp")
+Returns:
+- 0 on success.
+- 1 on failure.
+*/
+int	env_set(t_vars *vars, const char *key, const char *value)
+{
+	char	*line;
+	size_t	key_len;
+	size_t	val_len;
+
+	key_len = ft_strlen(key);
+	val_len = ft_strlen(value);
+	line = (char *)malloc(key_len + val_len + 2);
+	if (!line)
+		return (1);
+	ft_memcpy(line, key, key_len);
+	line[key_len] = '=';
+	ft_memcpy(line + key_len + 1, value, val_len + 1);
+	return (env_set_line(vars, line));
+}
+
+/*
+Removes a variable from the environment.
+- Shifts the following entries down to keep the original order.
+- Rebuilds the hash index since positions have moved.
+*/
+void	env_unset(t_vars *vars, const char *key)
+{
+	int	pos;
+
+	if (!key)
+		return ;
+	pos = env_index_find(vars, key, ft_strlen(key));
+	if (pos == -1)
+		return ;
+	ft_safefree((void **)&vars->env[pos]);
+	ft_memmove(&vars->env[pos], &vars->env[pos + 1],
+		sizeof(char *) * (vars->env_len - pos));
+	vars->env_len--;
+	build_env_index(vars);
+	vars->env_gen++;
+}
+
+/*
+Returns the environment to hand to execve()/posix_spawn().
+- The snapshot only points into vars->env, nothing is copied.
+- Variables exported without a value are left out.
+- Rebuilt only when the environment generation has changed.
+Returns:
+- NULL-terminated envp array.
+- vars->env itself if the snapshot cannot be allocated.
+*/
+char	**get_envp(t_vars *vars)
+{
+	int	i;
+	int	n;
+
+	if (vars->envp && vars->envp_gen == vars->env_gen)
+		return (vars->envp);
+	ft_safefree((void **)&vars->envp);
+	vars->envp = (char **)malloc(sizeof(char *) * (vars->env_len + 1));
+	if (!vars->envp)
+		return (vars->env);
+	i = 0;
+	n = 0;
+	while (i < vars->env_len)
+	{
+		if (ft_strchr(vars->env[i], '='))
+			vars->envp[n++] = vars->env[i];
+		i++;
+	}
+	vars->envp[n] = NULL;
+	vars->envp_gen = vars->env_gen;
+	return (vars->envp);
+}
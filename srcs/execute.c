@@ -37,7 +37,8 @@ int	handle_cmd_status(int status, t_vars *vars)
 
 /*
 Executes a command with redirection.
-- Saves original file descriptors.
+- Saves original file descriptors, close-on-exec so that commands
+  never inherit them.
 - Sets up redirection according to node type.
 - Executes the command with redirection in place.
 - Restores original file descriptors afterward.
@@ -51,8 +52,8 @@ int	exec_redirect_cmd(t_node *node, char **envp, t_vars *vars)
 	t_node	*cmd_node;
 
 	cmd_node = node->left;
-	vars->pipes->saved_stdin = dup(STDIN_FILENO);
-	vars->pipes->saved_stdout = dup(STDOUT_FILENO);
+	vars->pipes->saved_stdin = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, 0);
+	vars->pipes->saved_stdout = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 0);
 	if (!proc_redir_chain(node, vars))
 	{
 		reset_redirect_fds(vars);
@@ -136,7 +137,10 @@ int	execute_cmd(t_node *node, char **envp, t_vars *vars)
 /*
 Executes an external command (non-builtin).
 - Finds the command path in the PATH environment.
-- Forks a child process to execute the command.
+- Inside a pipeline stage child, or as the last command of a script
+  or -c string, replaces the process with the command: there is
+  nothing left for the shell to do after it.
+- Otherwise launches it with spawn_cmd(), inheriting the current fds.
 - In parent: waits for child and handles the exit status.
 - Properly updates vars->error_code with the command result.
 Returns:
@@ -145,7 +149,7 @@ Works with execute_cmd().
 
 Example: For "ls -la"
 - Locates path to ls executable (/bin/ls)
-- Executes in child process
+- Spawns it as a child process
 - Returns exit code (0 for success)
 */
 int	exec_external_cmd(t_node *node, char **envp, t_vars *vars)
@@ -158,15 +162,12 @@ int	exec_external_cmd(t_node *node, char **envp, t_vars *vars)
 	cmd_path = get_cmd_path(node, envp, vars);
 	if (!cmd_path)
 		return (vars->error_code);
-	pid = fork();
-	if (pid < 0)
-	{
-		ft_safefree((void **)&cmd_path);
-		return (vars->error_code = 1);
-	}
-	if (pid == 0)
+	if (vars->pipes->exec_in_place || input_at_end(vars))
 		exec_child(cmd_path, node->args, envp);
+	pid = spawn_cmd(cmd_path, node->args, NULL, vars);
 	ft_safefree((void **)&cmd_path);
+	if (pid == -1)
+		return (vars->error_code);
 	waitpid(pid, &status, 0);
 	return_code = handle_cmd_status(status, vars);
 	return (return_code);
@@ -6,27 +6,23 @@
 /*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/25 23:05:19 by bleow             #+#    #+#             */
-/*   Updated: 2025/06/01 23:24:24 by bleow            ###   ########.fr       */
+/*   Updated: 2025/06/14 16:02:37 by bleow            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /*
-Prepares a command node for execution within a pipe by:
+Prepares a command node for execution within a pipeline stage by:
 - Resolving the actual command if node_in_pipe is a redirection.
-- Handling nested pipes if in the RPIPE context.
 - Processing any redirections attached directly to the resolved command.
 
 Returns:
 - 0: Success, cmd_to_exec is set to a command node.
 - 1: General error during setup or invalid node type.
-- 2: Nested pipe detected (if lt_or_rt_side is RPIPE), cmd_to_exec
-	 is set to the TYPE_PIPE node.
 - Other non-zero values: vars->error codes from redirection processing.
 */
-int	setup_pipe_cmd(t_node *node_in_pipe, t_vars *vars,
-					t_node **cmd_to_exec, int lt_or_rt_side)
+int	setup_pipe_cmd(t_node *node_in_pipe, t_vars *vars, t_node **cmd_to_exec)
 {
 	t_node	*curr;
 	int		status;
@@ -40,11 +36,6 @@ int	setup_pipe_cmd(t_node *node_in_pipe, t_vars *vars,
 	}
 	else if (node_in_pipe->type == TYPE_CMD)
 		curr = node_in_pipe;
-	else if (lt_or_rt_side == RPIPE && node_in_pipe->type == TYPE_PIPE)
-	{
-		*cmd_to_exec = node_in_pipe;
-		return (2);
-	}
 	else
 		return (1);
 	status = scan_cmd_redirs(curr, vars);
@@ -55,103 +46,83 @@ int	setup_pipe_cmd(t_node *node_in_pipe, t_vars *vars,
 }
 
 /*
-Handles execution of the command on the left side of a pipe.
-- Redirects STDOUT of the child process to the write-end of the pipe.
-- Closes unused pipe file descriptors.
-- Prepares and executes the command node using setup_pipe_cmd and execute_cmd.
-
+Counts the stages of a pipe chain built by process_addon_pipes().
+- Every TYPE_PIPE node contributes its left command.
+- The right child of the last TYPE_PIPE node is the final stage.
 Returns:
-- The exit status code of the executed command.
-- 1 if a setup error (e.g., dup2 failure) occurs.
-- Propagated error codes from setup_pipe_cmd.
+- Number of commands in the pipeline.
 */
-int	exec_pipe_left(t_node *cmd_node, int pipe_fd[2], t_vars *vars)
+int	count_pipe_stages(t_node *pipe_node)
 {
-	int		cmd_code;
-	t_node	*curr;
-	int		setup_status;
+	int	stages;
 
-	close(pipe_fd[0]);
-	if (dup2(pipe_fd[1], STDOUT_FILENO) == -1)
+	stages = 1;
+	while (pipe_node && pipe_node->type == TYPE_PIPE)
 	{
-		close(pipe_fd[1]);
-		return (1);
+		stages++;
+		pipe_node = pipe_node->right;
 	}
-	close(pipe_fd[1]);
-	setup_status = setup_pipe_cmd(cmd_node, vars, &curr, LPIPE);
-	if (setup_status != 0)
-		return (setup_status);
-	cmd_code = execute_cmd(curr, vars->env, vars);
-	return (cmd_code);
+	return (stages);
 }
 
 /*
-Handles execution within the right child process of a pipe.
-- Redirects stdin to the pipe read end.
-- Closes the pipe read end.
-- Executes the command node.
-Returns:
-- The exit status code that should be used when exiting the process.
+Returns the next stage of a pipe chain and advances the cursor.
+- For a TYPE_PIPE node, returns its left command and moves to the right.
+- For the final stage, returns it and sets the cursor to NULL.
+Works with execute_pipes().
 */
-int	exec_pipe_right(t_node *cmd_node, int pipe_fd[2], t_vars *vars)
+t_node	*next_pipe_stage(t_node **cursor)
 {
-	int		cmd_code;
-	t_node	*curr;
-	int		setup_status;
+	t_node	*stage;
 
-	if (dup2(pipe_fd[0], STDIN_FILENO) == -1)
+	if ((*cursor)->type == TYPE_PIPE)
 	{
-		close(pipe_fd[0]);
-		return (1);
-	}
-	close(pipe_fd[0]);
-	setup_status = setup_pipe_cmd(cmd_node, vars, &curr, RPIPE);
-	if (setup_status == 2)
-	{
-		cmd_code = execute_pipes(curr, vars);
-		return (cmd_code);
+		stage = (*cursor)->left;
+		*cursor = (*cursor)->right;
+		return (stage);
 	}
-	else if (setup_status != 0)
-		return (setup_status);
-	cmd_code = execute_cmd(curr, vars->env, vars);
-	return (cmd_code);
+	stage = *cursor;
+	*cursor = NULL;
+	return (stage);
 }
 
 /*
-Executes commands connected by a pipe.
-- Sets up and launches pipeline child processes.
-- Waits for both processes to complete.
-- Captures status of command execution.
+Executes a whole pipeline of commands.
+- Counts the stages and allocates room for their pids.
+- Forks every stage directly from the shell, chaining them with pipes.
+- Reaps all stages in the order they finish.
 Returns:
-- Status of right command.
+- Status of the last command.
 - 1 on error.
 Works with execute_cmd() for pipeline execution.
 */
 int	execute_pipes(t_node *pipe_node, t_vars *vars)
 {
-	int		pipe_fd[2];
-	pid_t	left_pid;
-	pid_t	right_pid;
-	int		left_status;
-	int		right_status;
+	t_node	*cursor;
+	t_node	*stage;
+	int		in_fd;
+	int		started;
 
-	if (pipe(pipe_fd) == -1)
+	vars->pipes->pipe_count = count_pipe_stages(pipe_node) - 1;
+	ft_safefree((void **)&vars->pipes->pids);
+	vars->pipes->pids = malloc(sizeof(pid_t) * (vars->pipes->pipe_count + 1));
+	if (!vars->pipes->pids)
+		return (vars->error_code = 1);
+	cursor = pipe_node;
+	in_fd = -1;
+	started = 0;
+	while (cursor)
 	{
-		perror("pipe");
-		vars->error_code = 1;
-		return (1);
+		stage = next_pipe_stage(&cursor);
+		vars->pipes->pids[started] = fork_pipe_stage(stage, &in_fd,
+				cursor != NULL, vars);
+		if (vars->pipes->pids[started] == -1)
+			break ;
+		started++;
 	}
-	left_pid = fork_left_pipe_branch(pipe_node->left, pipe_fd, vars);
-	if (left_pid == -1)
-		return (vars->error_code = 1);
-	right_pid = fork_right_pipe_branch(pipe_node->right, pipe_fd, vars,
-			left_pid);
-	if (right_pid == -1)
-		return (vars->error_code = 1);
-	waitpid(left_pid, &left_status, 0);
-	waitpid(right_pid, &right_status, 0);
-	handle_cmd_status(right_status, vars);
-	return (vars->error_code);
+	if (in_fd != -1)
+		close(in_fd);
+	return (reap_pipe_stages(started, vars));
 }
 
 /*
@@ -22,18 +22,8 @@ Note: This function never returns (it either executes or exits)
 */
 void	exec_child(char *cmd_path, char **args, char **envp)
 {
-	int	error_code;
-
 	execve(cmd_path, args, envp);
-	if (errno == EACCES)
-		error_code = ERR_PERMISSIONS;
-	else if (errno == ENOENT)
-		error_code = ERR_CMD_NOT_FOUND;
-	else if (errno == EISDIR)
-		error_code = ERR_ISDIRECTORY;
-	else
-		error_code = ERR_CMD_NOT_FOUND;
-	shell_error(cmd_path, error_code, NULL);
+	shell_error(cmd_path, exec_error_code(errno), NULL);
 	ft_safefree((void **)&cmd_path);
 	exit(127);
 }
@@ -111,10 +101,10 @@ int	setup_redirection(t_node *node, t_vars *vars)
 	else
 	{
 		vars->pipes->cmd_redir = cmd_node;
-		if (node->type == TYPE_IN_REDIR || node->type == TYPE_HEREDOC)
-			vars->pipes->last_in_redir = node;
-		else if (node->type == TYPE_OUT_REDIR || node->type == TYPE_APPD_REDIR)
+		if (node->type == TYPE_OUT_REDIR || node->type == TYPE_APPD_REDIR)
 			vars->pipes->last_out_redir = node;
+		else
+			vars->pipes->last_in_redir = node;
 		if (!proc_redir_target(node, vars))
 			return (0);
 		result = redir_mode_setup(node, vars);
@@ -135,7 +125,7 @@ int	proc_redir_target(t_node *node, t_vars *vars)
 {
 	if (node && node->args && node->args[0])
 	{
-		if (node->type != TYPE_HEREDOC)
+		if (node->type != TYPE_HEREDOC && node->type != TYPE_HERESTRING)
 			strip_outer_quotes(&node->args[0], vars);
 		return (1);
 	}
@@ -149,7 +139,7 @@ int	proc_redir_target(t_node *node, t_vars *vars)
 
 /*
 Sets up a specific type of redirection based on node type.
-- Handles input, output, append, and heredoc redirections.
+- Handles input, output, append, heredoc and here-string redirections.
 - Updates mode flags and calls appropriate setup functions.
 - Centralizes error handling for all redirection types.
 - Triggers interactive heredoc gathering if content is not ready.
@@ -175,7 +165,7 @@ int	redir_mode_setup(t_node *node, t_vars *vars)
 		vars->pipes->out_mode = OUT_MODE_APPEND;
 		result = setup_out_redir(node, vars);
 	}
-	else if (node->type == TYPE_HEREDOC)
+	else if (node->type == TYPE_HEREDOC || node->type == TYPE_HERESTRING)
 		result = setup_heredoc_redir(node, vars);
 	if (!result)
 		vars->error_code = ERR_DEFAULT;
@@ -15,7 +15,8 @@
 /*
 Processes special shell variables like $? and $0.
 - Handles $?: Returns exit status of last command.
-- Handles $0: Returns shell name ("bleshell").
+- Handles $0 to $9, $#, $@ and $*: positional parameters, see
+  positional_var().
 - For empty var_name: Returns an empty string.
 Returns:
 - Newly allocated string with variable value.
@@ -35,10 +36,8 @@ char	*handle_special_var(const char *var_name, t_vars *vars)
 		result = ft_itoa(vars->error_code);
 		return (result);
 	}
-	if (ft_strcmp(var_name, "0") == 0)
-	{
-		return (ft_strdup("bleshell"));
-	}
+	if (is_param_char(var_name[0]) && !var_name[1])
+		return (positional_var(var_name, vars));
 	return (NULL);
 }
 
@@ -62,7 +61,7 @@ char	*get_var_value(const char *var_name, t_vars *vars)
 	result = handle_special_var(var_name, vars);
 	if (!result)
 	{
-		result = get_env_val(var_name, vars->env);
+		result = get_env_val(var_name, vars);
 		if (!result)
 			result = ft_strdup("");
 	}
@@ -105,46 +104,35 @@ char	*expand_variable(char *input, int *pos, char *var_name, t_vars *vars)
 
 /*
 Retrieves value of an environment variable from vars->env.
-- Searches through environment array for matching variable.
+- Finds the variable through the environment hash index.
 - Extracts value portion after the '=' character.
 - Returns empty string for missing variables.
 Returns:
 - Newly allocated string containing variable value.
 - Empty string if variable not found or on errors.
 Example: For "HOME=/Users/bleow" in environment:
-get_env_val("HOME", env) -> "/Users/bleow"
-get_env_val("NONEXISTENT", env) -> ""
+get_env_val("HOME", vars) -> "/Users/bleow"
+get_env_val("NONEXISTENT", vars) -> ""
 */
-char	*get_env_val(const char *var_name, char **env)
+char	*get_env_val(const char *var_name, t_vars *vars)
 {
-	int		i;
-	size_t	var_len;
-	char	*val;
+	int		pos;
+	int		var_len;
 
-	if (!var_name || !*var_name || !env)
-	{
-		val = ft_strdup("");
-		return (val);
-	}
+	if (!var_name || !*var_name || !vars->env)
+		return (ft_strdup(""));
 	var_len = ft_strlen(var_name);
-	i = 0;
-	while (env[i])
-	{
-		if (!ft_strncmp(env[i], var_name, var_len) && env[i][var_len] == '=')
-		{
-			val = ft_strdup(env[i] + var_len + 1);
-			return (val);
-		}
-		i++;
-	}
-	val = ft_strdup("");
-	return (val);
+	pos = env_index_find(vars, var_name, var_len);
+	if (pos == -1 || vars->env[pos][var_len] != '=')
+		return (ft_strdup(""));
+	return (ft_strdup(vars->env[pos] + var_len + 1));
 }
 
 /*
 Extracts variable name from input string.
 - Takes input string and current position.
 - Extracts variable name (alphanumeric + underscore).
+- $?, $# and positional parameters take a single character.
 - Updates position to point after the variable name.
 Returns:
 Newly allocated string containing variable name.
@@ -156,14 +144,14 @@ char	*get_var_name(char *input, int *pos)
 	char	*var_name;
 
 	start = *pos;
-	if (input[*pos] == '?')
+	if (input[*pos] == '?' || is_param_char(input[*pos]))
 	{
 		(*pos)++;
-		var_name = ft_strdup("?");
+		var_name = ft_strndup(input + start, 1);
 		return (var_name);
 	}
 	while (input[*pos] && (ft_isalnum(input[*pos]) || input[*pos] == '_'))
 		(*pos)++;
-	var_name = ft_substr(input, start, *pos - start);
+	var_name = ft_strndup(input + start, *pos - start);
 	return (var_name);
 }
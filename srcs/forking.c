@@ -6,72 +6,160 @@
 /*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/30 12:14:46 by bleow             #+#    #+#             */
-/*   Updated: 2025/05/30 12:27:33 by bleow            ###   ########.fr       */
+/*   Updated: 2025/06/14 16:02:37 by bleow            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /*
-Creates child process for left side of a pipe command.
-- Sets up process to write output to pipe
-- Handles fork errors with appropriate cleanup
-- Child process executes the command and exits
-- Parent process closes write end and continues
+Runs one pipeline stage inside its child process.
+- Closes the read end of the outgoing pipe.
+- Redirects STDIN from the previous pipe and STDOUT to the next one.
+- Prepares and executes the stage with setup_pipe_cmd and execute_cmd.
+- External commands replace the child instead of forking again.
+Returns:
+- The exit status code that should be used when exiting the process.
+- 1 if a dup2 failure occurs.
+*/
+int	exec_pipe_stage(t_node *stage, int in_fd, int out_pipe[2], t_vars *vars)
+{
+	t_node	*curr;
+	int		setup_status;
+
+	if (out_pipe[0] != -1)
+		close(out_pipe[0]);
+	if (in_fd != -1 && dup2(in_fd, STDIN_FILENO) == -1)
+		return (1);
+	if (out_pipe[1] != -1 && dup2(out_pipe[1], STDOUT_FILENO) == -1)
+		return (1);
+	if (in_fd != -1)
+		close(in_fd);
+	if (out_pipe[1] != -1)
+		close(out_pipe[1]);
+	vars->pipes->exec_in_place = 1;
+	setup_status = setup_pipe_cmd(stage, vars, &curr);
+	if (setup_status != 0)
+		return (setup_status);
+	return (execute_cmd(curr, get_envp(vars), vars));
+}
+
+/*
+Forks a shell child to run a pipeline stage.
+- Used for builtins and stages that carry redirections.
+- Child process executes the stage and exits.
+- Flushes builtin output first so the child cannot write it again.
 Returns:
 - Process ID of child on success
 - (-1) on fork failure
 */
-pid_t	fork_left_pipe_branch(t_node *node, int pipe_fd[2], t_vars *vars)
+pid_t	fork_stage_child(t_node *stage, int in_fd, int out_pipe[2],
+			t_vars *vars)
 {
 	pid_t	pid;
 
+	out_flush(&vars->out);
 	pid = fork();
 	if (pid == -1)
-	{
-		perror("fork (left)");
-		close(pipe_fd[0]);
-		close(pipe_fd[1]);
-		return (-1);
-	}
-	if (pid == 0)
-	{
-		exit(exec_pipe_left(node, pipe_fd, vars));
-	}
-	close(pipe_fd[1]);
+		perror("fork");
+	else if (pid == 0)
+		exit(exec_pipe_stage(stage, in_fd, out_pipe, vars));
 	return (pid);
 }
 
 /*
-Creates child process for right side of a pipe command.
-- Sets up process to read input from pipe
-- Handles fork errors with cleanup of both pipe ends
-- Terminates left process if already running when error occurs
-- Child process executes the command and exits
-- Parent process closes read end and continues
+Creates the child process for one pipeline stage.
+- A builtin as the last stage runs in the shell itself with
+  run_lastpipe_stage() when lastpipe is set.
+- Opens the pipe to the next stage unless this is the last one.
+- Plain external commands are spawned directly with spawn_pipe_stage().
+- Anything else is forked with fork_stage_child().
+- Parent closes the fds the child now owns and keeps the read end
+  of the new pipe in in_fd for the next stage.
 Returns:
 - Process ID of child on success
-- (-1) on fork failure
+- 0 if a spawned stage could not be launched or ran in the shell
+- (-1) on pipe or fork failure
 */
-pid_t	fork_right_pipe_branch(t_node *node, int pipe_fd[2], t_vars *vars,
-			pid_t left_child_pid)
+pid_t	fork_pipe_stage(t_node *stage, int *in_fd, int has_next, t_vars *vars)
 {
+	int		out_pipe[2];
 	pid_t	pid;
 
-	pid = fork();
-	if (pid == -1)
+	if (!has_next && is_lastpipe_stage(stage, vars))
+		return (run_lastpipe_stage(stage, in_fd, vars));
+	out_pipe[0] = -1;
+	out_pipe[1] = -1;
+	if (has_next && pipe(out_pipe) == -1)
 	{
-		perror("fork (right)");
-		close(pipe_fd[0]);
-		if (left_child_pid > 0)
-		{
-			kill(left_child_pid, SIGTERM);
-			waitpid(left_child_pid, NULL, 0);
-		}
+		perror("pipe");
 		return (-1);
 	}
-	if (pid == 0)
-		exit(exec_pipe_right(node, pipe_fd, vars));
-	close(pipe_fd[0]);
+	if (can_spawn_stage(stage))
+		pid = spawn_pipe_stage(stage, *in_fd, out_pipe, vars);
+	else
+		pid = fork_stage_child(stage, *in_fd, out_pipe, vars);
+	if (*in_fd != -1)
+		close(*in_fd);
+	if (out_pipe[1] != -1)
+		close(out_pipe[1]);
+	*in_fd = out_pipe[0];
 	return (pid);
 }
+
+/*
+Waits for one pipeline stage child.
+- Retries when the wait is interrupted by a signal.
+- Only this pid is reaped, other children of the shell are left alone.
+Returns:
+- 1 once the child is reaped, with its status in *status.
+- 0 if it cannot be waited for.
+*/
+int	wait_stage(pid_t pid, int *status)
+{
+	while (waitpid(pid, status, 0) == -1)
+	{
+		if (errno != EINTR)
+			return (0);
+	}
+	return (1);
+}
+
+/*
+Waits for every started pipeline stage.
+- Waits on the recorded pids in order, so only this pipeline's
+  children are reaped.
+- Stages without a child (pid 0) are skipped.
+- Keeps the status of the last stage for the pipeline result.
+- A last stage that was never launched keeps the error code set
+  when its launch failed.
+- A pipeline that could not start all its stages reports 1.
+Returns:
+- Final pipeline exit code, also stored in vars->error_code.
+*/
+int	reap_pipe_stages(int started, t_vars *vars)
+{
+	pid_t	last_pid;
+	int		status;
+	int		last_status;
+	int		i;
+
+	last_pid = -1;
+	if (started == vars->pipes->pipe_count + 1)
+		last_pid = vars->pipes->pids[started - 1];
+	last_status = 0;
+	i = 0;
+	while (i < started)
+	{
+		if (vars->pipes->pids[i] > 0
+			&& wait_stage(vars->pipes->pids[i], &status)
+			&& vars->pipes->pids[i] == last_pid)
+			last_status = status;
+		i++;
+	}
+	if (last_pid == -1)
+		return (vars->error_code = 1);
+	if (last_pid > 0)
+		handle_cmd_status(last_status, vars);
+	return (vars->error_code);
+}
@@ -11,57 +11,41 @@
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
-#include <string.h>
 
 /*
-Creates child process to gather heredoc input interactively.
-- Opens temporary file for storing heredoc content
-- Forks child process to handle input collection
-- Waits for child process to complete
-- Processes child status via process_hd_parent
-- Preserves signal state across heredoc operation
+Reads the rest of a heredoc body from the terminal in the shell itself.
+- Opens the heredoc store unless lines were already written to it
+- Collects lines with get_interactive_hd(), no child process is used
+- Discards the whole command line when reading is interrupted
 Returns:
 - 1 on successful heredoc completion
-- 0 on errors (file open, fork failure, interruption)
+- 0 on errors (store, write failure, interruption)
 */
-int	interactive_hd_mode(t_vars *vars, int sss, int status)
+int	interactive_hd_mode(t_vars *vars)
 {
-	pid_t	pid;
-
-	vars->pipes->hd_fd = open(TMP_BUF, O_WRONLY | O_CREAT | O_APPEND, 0600);
-	if (vars->pipes->hd_fd == -1)
-	{
-		vars->error_code = ERR_DEFAULT;
+	if (vars->pipes->hd_fd < 0 && open_hd_store(vars) == -1)
 		return (0);
-	}
-	pid = fork();
-	if (pid == -1)
+	if (get_interactive_hd(vars->pipes->hd_fd, vars) == -1)
 	{
-		if (vars->pipes->hd_fd != -1)
-		{
-			close(vars->pipes->hd_fd);
-			vars->pipes->hd_fd = -1;
-		}
-		vars->error_code = ERR_DEFAULT;
-		g_signal_received = sss;
+		hd_abort_cleanup(vars);
 		return (0);
 	}
-	if (pid == 0)
-		exec_hd_child(vars);
-	return (process_hd_parent(pid, status, sss, vars));
+	vars->hd_text_ready = 1;
+	return (1);
 }
 
 /*
 Performs cleanup for heredoc termination scenarios.
-- Restores terminal state to pre-heredoc settings
+- Puts back the shell's own SIGINT handler and removes the event hook
 - Restores original signal handling state
 - Frees line buffer if provided
 - Returns the specified exit code unchanged
 Used by get_interactive_hd() for consistent cleanup.
 */
-int	hd_term(int saved_signal_state, t_vars *vars, int code, char **line)
+int	hd_term(int saved_signal_state, int code, char **line)
 {
-	manage_terminal_state(vars, TERM_RESTORE);
+	rl_event_hook = NULL;
+	load_signals();
 	g_signal_received = saved_signal_state;
 	if (line && *line)
 	{
@@ -76,9 +60,11 @@ Reads lines interactively until the delimiter is found or EOF is reached.
 - Writes lines to the given open file descriptor `write_fd`.
 - Uses vars->pipes->heredoc_delim as the delimiter.
 - Performs expansion based on vars->pipes->hd_expand via write_to_hd.
+- Ctrl+C ends readline() through hd_event_hook() and cancels the
+  heredoc with error code 130.
 Returns:
-- 0 on success (delimiter found or EOF reached after warning).
-- -1 on failure (write error or malloc error).
+- 0 on success (delimiter found or EOF reached).
+- -1 on interruption or failure (write error or malloc error).
 */
 int	get_interactive_hd(int write_fd, t_vars *vars)
 {
@@ -87,79 +73,42 @@ int	get_interactive_hd(int write_fd, t_vars *vars)
 
 	saved_signal_state = g_signal_received;
 	g_signal_received = -1;
-	signal(SIGQUIT, SIG_IGN);
-	manage_terminal_state(vars, TERM_HEREDOC);
+	signal(SIGINT, hd_sigint_handler);
+	rl_event_hook = hd_event_hook;
 	while (1)
 	{
+		line = input_line(vars, "> ");
 		if (g_signal_received == -2)
-			return (hd_term(saved_signal_state, vars, -1, &line));
-		line = readline("> ");
-		if (!line)
 		{
-			g_signal_received = saved_signal_state;
-			break ;
+			vars->error_code = 130;
+			return (hd_term(saved_signal_state, -1, &line));
 		}
-		if (ft_strcmp(line, vars->pipes->heredoc_delim) == 0)
-			return (hd_term(saved_signal_state, vars, 0, &line));
+		if (!line || ft_strcmp(line, vars->pipes->heredoc_delim) == 0)
+			return (hd_term(saved_signal_state, 0, &line));
 		if (!write_to_hd(write_fd, line, vars))
-			return (hd_term(saved_signal_state, vars, -1, &line));
+			return (hd_term(saved_signal_state, -1, &line));
 		ft_safefree((void **)&line);
 	}
-	return (hd_term(saved_signal_state, vars, 0, &line));
 }
 
 /*
-Sets up redirection using the heredoc fd stored in vars->pipes->hd_fd.
-Calls process_heredoc() to ensure content is ready
-(either reads interactively or opens pre-stored file).
+Sets up stdin from the heredoc body gathered for this node.
+- Rewinds the node's store and hands it straight to dup2().
+- A small here-string is a pipe, which cannot be rewound.
+- The store stays open, so the node can be read again if needed,
+  and is closed with the token list.
 Returns:
 - 1 on success.
-- 0 on failure (e.g., TMP_BUF not ready, fd already open).
+- 0 on failure (e.g., body was never gathered).
 */
 int	handle_heredoc(t_node *node, t_vars *vars)
 {
-	if (!process_heredoc(node, vars))
-		return (0);
-	if (vars->pipes->hd_fd < 0)
-		return (0);
-	if (dup2(vars->pipes->hd_fd, STDIN_FILENO) == -1)
+	if (!node || node->hd_fd < 0
+		|| (lseek(node->hd_fd, 0, SEEK_SET) == -1 && errno != ESPIPE)
+		|| dup2(node->hd_fd, STDIN_FILENO) == -1)
 	{
-		close(vars->pipes->hd_fd);
-		vars->pipes->hd_fd = -1;
 		vars->error_code = ERR_DEFAULT;
 		return (0);
 	}
-	close(vars->pipes->hd_fd);
-	vars->pipes->hd_fd = -1;
-	return (1);
-}
-
-/*
-Opens TMP_BUF for reading and stores the fd in vars->pipes->hd_fd.
-Assumes heredoc content is already fully gathered in TMP_BUF.
-Returns:
-- 1 on success.
-- 0 on failure (e.g., TMP_BUF not ready, fd already open).
-- Sets vars->error_code to ERR_DEFAULT on failure.
-*/
-int	process_heredoc(t_node *node, t_vars *vars)
-{
-	if (!node || !vars || !vars->pipes)
-	{
-		vars->error_code = ERR_DEFAULT;
-		return (0);
-	}
-	if (vars->pipes->hd_fd >= 0)
-	{
-		close(vars->pipes->hd_fd);
-		vars->pipes->hd_fd = -1;
-	}
-	if (!vars->hd_text_ready)
-	{
-		vars->error_code = ERR_DEFAULT;
-		return (0);
-	}
-	if (!read_tmp_buf(vars))
-		return (0);
 	return (1);
 }
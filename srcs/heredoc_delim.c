@@ -115,6 +115,7 @@ int	chk_hd_first_line(char *line_start, int len, t_vars *vars)
 Processes a heredoc line: 
 - Checks if it matches delimiter. If match, it will return 1 and exit.
 - Else it writes the line to file.
+- The line stays owned by the caller.
 Returns:
 - 1 if delimiter found.
 - 0 if processed normally.
@@ -122,19 +123,9 @@ Returns:
 */
 int	proc_hd_line(int write_fd, char *line, t_vars *vars)
 {
-	size_t	delim_len;
-	int		result;
-
-	delim_len = ft_strlen(vars->pipes->heredoc_delim);
-	if (ft_strncmp(line, vars->pipes->heredoc_delim, delim_len) == 0
-		&& line[delim_len] == '\0')
-	{
-		ft_safefree((void **)&line);
+	if (ft_strcmp(line, vars->pipes->heredoc_delim) == 0)
 		return (1);
-	}
-	result = write_to_hd(write_fd, line, vars);
-	ft_safefree((void **)&line);
-	if (!result)
+	if (!write_to_hd(write_fd, line, vars))
 		return (-1);
 	return (0);
 }
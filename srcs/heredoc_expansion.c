@@ -14,140 +14,150 @@
 
 /*
 Expands variables in a heredoc line
+- Text and expanded values are appended straight to the heredoc
+  write buffer, so the expanded line is never built on its own.
 Returns:
-- Newly allocated string with variables expanded.
-- Empty string on NULL input or if no expansions/error.
+- 1 on success.
+- 0 on memory allocation failure.
 */
-char	*hd_expander(char *line, t_vars *vars)
+int	hd_expander(t_strbuf *result, char *line, t_vars *vars)
 {
-	int		pos;
-	char	*result;
-	char	*segment;
+	int	pos;
+	int	appended;
 
-	if (!line || !vars)
-		return (ft_strdup(""));
-	result = NULL;
 	pos = 0;
-	while (line[pos])
+	appended = 1;
+	while (line[pos] && appended)
 	{
 		if (line[pos] == '$')
-		{
-			segment = expand_hd_var(line, &pos, vars);
-			result = hd_merge_and_free(result, segment);
-		}
+			appended = append_hd_var(result, line, &pos, vars);
 		else
-		{
-			segment = read_hd_str(line, &pos);
-			result = hd_merge_and_free(result, segment);
-		}
-		ft_safefree((void **)&segment);
+			appended = append_hd_str(result, line, &pos);
 	}
-	if (!result)
-		return (ft_strdup(""));
-	return (result);
+	return (appended);
 }
 
 /*
-Prepares a line for heredoc by conditionally expanding variables.
-- Expands variables if hd_expand flag is set
-- Creates a simple copy otherwise
+Writes the heredoc write buffer to the store with write_iov().
+- An optional tail line (plus its newline) is written right after the
+  buffered lines without being copied into the buffer first.
+- Short writes and signals are retried until every byte is out.
+- Empties the buffer, which keeps its memory for the next lines.
 Returns:
-- Newly allocated string with expanded or copied content.
-- NULL on memory allocation failure.
+- 1 on success.
+- 0 on write failure (sets vars->error_code).
+Works with write_to_hd() and read_hd_body().
 */
-char	*prepare_hd_line(char *line, t_vars *vars)
+int	flush_hd_buf(int fd, char *tail, size_t tail_len, t_vars *vars)
 {
-	char	*result;
+	struct iovec	iov[3];
+	t_strbuf		*buf;
 
-	if (!line || !vars || !vars->pipes)
-		return (NULL);
-	if (vars->pipes->hd_expand == 1)
-		result = hd_expander(line, vars);
-	else
-		result = ft_strdup(line);
-	return (result);
+	buf = &vars->pipes->hd_buf;
+	iov[0].iov_base = buf->buf;
+	iov[0].iov_len = buf->len;
+	iov[1].iov_base = tail;
+	iov[1].iov_len = tail_len;
+	iov[2].iov_base = "\n";
+	iov[2].iov_len = (tail != NULL);
+	buf->len = 0;
+	if (write_iov(fd, iov, 3) == -1)
+	{
+		vars->error_code = ERR_DEFAULT;
+		return (0);
+	}
+	return (1);
 }
 
 /*
-Extracts and expands a variable from heredoc line.
+Expands a variable from heredoc line and appends it to the buffer.
 - Processes a variable starting with $ character.
-- Falls back to returning "$" if expansion fails.
+- Falls back to appending "$" if expansion fails.
 Returns:
-Newly allocated string with expanded variable.
-"$" if variable can't be expanded.
-Works with expand_one_line().
+- 1 on success.
+- 0 on memory allocation failure.
+Works with hd_expander().
 
 Example: At position of "$HOME" in a line
-- Returns: "/Users/username" (expanded value)
+- Appends: "/Users/username" (expanded value)
 - Updates position to after variable name
 */
-char	*expand_hd_var(char *line, int *pos, t_vars *vars)
+int	append_hd_var(t_strbuf *result, char *line, int *pos, t_vars *vars)
 {
 	char	*expanded;
 	int		old_pos;
+	int		appended;
 
 	old_pos = *pos;
 	expanded = expand_variable(line, pos, NULL, vars);
 	if (!expanded)
 	{
 		*pos = old_pos + 1;
-		expanded = ft_strdup("$");
-		return (expanded);
+		return (ft_sb_append(result, "$", 1));
 	}
-	return (expanded);
+	appended = ft_sb_append(result, expanded, ft_strlen(expanded));
+	ft_safefree((void **)&expanded);
+	return (appended);
 }
 
 /*
-Extracts a regular text string up to $ character.
+Appends a regular text string up to $ character.
 - Processes text segment from current position to next $.
-- Creates substring of this text segment.
+- Copies the segment straight from the line into the buffer.
 Returns:
-- Newly allocated substring from start to next variable.
-- NULL if no characters to extract.
-Works with expand_one_line().
+- 1 on success.
+- 0 on memory allocation failure.
+Works with hd_expander().
 
 Example: At start of "Hello $USER"
-- Returns: "Hello "
+- Appends: "Hello "
 - Updates position to the $ character
 */
-char	*read_hd_str(char *line, int *pos)
+int	append_hd_str(t_strbuf *result, char *line, int *pos)
 {
 	int	start;
 
 	start = *pos;
 	while (line[*pos] && line[*pos] != '$')
 		(*pos)++;
-	if (*pos > start)
-		return (ft_substr(line, start, *pos - start));
-	return (NULL);
+	return (ft_sb_append(result, line + start, *pos - start));
 }
 
 /*
-Writes line to heredoc fd (TMP_BUF) with variable expansion
+Adds a line to the heredoc body with variable expansion
 based on vars->pipes->hd_expand.
+- Lines collect in vars->pipes->hd_buf and reach the store in
+  HD_FLUSH_SZ chunks instead of one write per line.
+- A non-expanding line that would not fit is handed to writev()
+  as is, so plain lines are never copied one by one.
 Returns:
 - 1 on success.
 - 0 on failure.
 */
 int	write_to_hd(int fd, char *line, t_vars *vars)
 {
-	char	*expanded_line;
-	int		write_result;
+	t_strbuf	*buf;
+	size_t		len;
+	int			appended;
 
 	if (!line || fd < 0 || !vars || !vars->pipes)
 		return (0);
-	expanded_line = prepare_hd_line(line, vars);
-	if (!expanded_line)
-		return (0);
-	write_result = write(fd, expanded_line, ft_strlen(expanded_line));
-	if (write_result != -1)
-		write(fd, "\n", 1);
-	ft_safefree((void **)&expanded_line);
-	if (write_result == -1)
+	buf = &vars->pipes->hd_buf;
+	if (vars->pipes->hd_expand == 1)
+		appended = hd_expander(buf, line, vars);
+	else
+	{
+		len = ft_strlen(line);
+		if (buf->len + len + 1 > HD_FLUSH_SZ)
+			return (flush_hd_buf(fd, line, len, vars));
+		appended = ft_sb_append(buf, line, len);
+	}
+	if (!appended || !ft_sb_append(buf, "\n", 1))
 	{
 		vars->error_code = ERR_DEFAULT;
 		return (0);
 	}
-	else
-		return (1);
+	if (buf->len >= HD_FLUSH_SZ)
+		return (flush_hd_buf(fd, NULL, 0, vars));
+	return (1);
 }
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_gather.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/21 13:40:18 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/21 20:16:52 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Finds the delimiter token of a heredoc node.
+The tokenizer creates it as the TYPE_ARGS token right after "<<".
+Returns:
+- Pointer to the delimiter token.
+- NULL if the heredoc has no delimiter.
+*/
+t_node	*find_hd_delim(t_node *hd_node)
+{
+	t_node	*delim_node;
+
+	delim_node = hd_node->next;
+	if (!delim_node || delim_node->type != TYPE_ARGS
+		|| !delim_node->args || !delim_node->args[0])
+		return (NULL);
+	return (delim_node);
+}
+
+/*
+Makes a heredoc node's delimiter the active one for reading its body.
+- Validates and unquotes the delimiter through is_valid_delim(),
+  which sets vars->pipes->heredoc_delim and hd_expand.
+- Records the expansion mode on the node itself.
+Returns:
+- 1 on success.
+- 0 on failure (sets vars->error_code).
+*/
+int	set_hd_delim(t_node *hd_node, t_vars *vars)
+{
+	t_node	*delim_node;
+
+	delim_node = find_hd_delim(hd_node);
+	if (!delim_node)
+	{
+		tok_syntax_error_msg("newline", vars);
+		return (0);
+	}
+	if (!is_valid_delim(delim_node->args[0], vars))
+		return (0);
+	hd_node->hd_expand = vars->pipes->hd_expand;
+	return (1);
+}
+
+/*
+Reads the body of one heredoc into its own store.
+- Starts from an empty heredoc write buffer, dropping anything left
+  over from an interrupted body.
+- Takes lines already buffered in vars->hd_src (pasted input) first.
+- Reads the rest interactively if the delimiter was not buffered.
+- Flushes the buffered body, then moves the store fd from
+  vars->pipes->hd_fd to hd_node->hd_fd.
+Returns:
+- 1 on success.
+- 0 on failure or interruption. An interrupted read has already
+  released the token list, so hd_node must not be used afterwards.
+*/
+int	read_hd_body(t_node *hd_node, t_vars *vars)
+{
+	int	write_fd;
+	int	found;
+
+	vars->pipes->hd_buf.len = 0;
+	write_fd = open_hd_store(vars);
+	if (write_fd == -1)
+		return (0);
+	found = 0;
+	if (vars->hd_src)
+		found = proc_hd_buffer(write_fd, &vars->hd_src, vars);
+	if (found == -1 || handle_interactive_hd(found, vars) == -1
+		|| !flush_hd_buf(vars->pipes->hd_fd, NULL, 0, vars))
+	{
+		close_hd_store(vars);
+		return (0);
+	}
+	hd_node->hd_fd = vars->pipes->hd_fd;
+	vars->pipes->hd_fd = -1;
+	return (1);
+}
+
+/*
+Collects the bodies of all heredocs of the command line in one pass.
+- Walks the token list in input order, so bodies are read in the
+  order their "<<" operators appear.
+- Every TYPE_HEREDOC node gets its own store and expansion mode,
+  which lets several heredocs share a command or a pipeline.
+- Here-string (<<<) words are expanded into their payload here too.
+- Runs before the pipeline is launched, so each stage only needs to
+  dup2() its node's fd.
+Returns:
+- 1 on success.
+- 0 on failure (the command must not run).
+Works with process_command().
+*/
+int	gather_heredocs(t_vars *vars)
+{
+	t_node	*current;
+
+	current = vars->head;
+	while (current)
+	{
+		if (current->type == TYPE_HEREDOC && current->hd_fd < 0
+			&& (!set_hd_delim(current, vars)
+				|| !read_hd_body(current, vars)))
+			break ;
+		if (current->type == TYPE_HERESTRING && current->hd_fd < 0
+			&& !read_herestring(current, vars))
+			break ;
+		current = current->next;
+	}
+	vars->hd_src = NULL;
+	if (current)
+		return (0);
+	vars->hd_text_ready = 1;
+	return (1);
+}
@@ -13,42 +13,45 @@
 #include "../includes/minishell.h"
 
 /*
-Joins a chunk to an existing string, freeing the original string.
-- Takes base string and chunk to append.
-- Creates new joined string and frees original.
+Creates the anonymous in-memory file that holds the heredoc body.
+- Uses memfd_create(), falling back to an O_TMPFILE file in
+  HD_STORE_DIR when memfd is unavailable.
+- Nothing is ever linked into the filesystem, so concurrent shells
+  sharing a cwd cannot see each other's heredocs.
+- The fd is stored in vars->pipes->hd_fd for writing and reading.
 Returns:
-Newly allocated string with combined content.
-Original input string if chunk is NULL.
-New copy of chunk if base string is NULL.
-Works with hd_expander().
-
-Example: str = "Hello", chunk = " World"
-- Returns: "Hello World"
-- Original "Hello" string is freed
+- The new file descriptor.
+- -1 on failure (sets vars->error_code).
 */
-char	*hd_merge_and_free(char *str, char *chunk)
+int	open_hd_store(t_vars *vars)
 {
-	char	*new_str;
+	int	fd;
 
-	if (!chunk)
-		return (str);
-	if (!str)
-		return (ft_strdup(chunk));
-	new_str = ft_strjoin(str, chunk);
-	ft_safefree((void **)&str);
-	return (new_str);
+	close_hd_store(vars);
+	fd = memfd_create(HD_STORE_NAME, MFD_CLOEXEC);
+	if (fd == -1)
+		fd = open(HD_STORE_DIR, O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	if (fd == -1)
+	{
+		perror("bleshell: heredoc");
+		vars->error_code = ERR_DEFAULT;
+		return (-1);
+	}
+	vars->pipes->hd_fd = fd;
+	return (fd);
 }
 
 /*
-Cleans up resources after a heredoc error.
-- Closes the file descriptor.
-- Removes the temporary file.
-Works with process_heredoc_path to centralize error handling.
+Closes the heredoc store, which also releases its content.
+Works with read_hd_body() to centralize error handling.
 */
-void	cleanup_heredoc_fd(int write_fd)
+void	close_hd_store(t_vars *vars)
 {
-	close(write_fd);
-	unlink(TMP_BUF);
+	if (vars->pipes->hd_fd >= 0)
+	{
+		close(vars->pipes->hd_fd);
+		vars->pipes->hd_fd = -1;
+	}
 }
 
 /*
@@ -89,27 +92,3 @@ int	proc_hd_delim(char *input, t_vars *vars, int *hd_is_delim)
 	vars->next_flag = 1;
 	return (1);
 }
-
-/*
-Opens the temporary heredoc file (TMP_BUF) for reading.
-Stores the file descriptor in vars->pipes->hd_fd on success.
-Handles errors and attempts to unlink the TMP_BUF on failure.
-Returns:
-- 1 on success.
-- 0 on failure.
-*/
-int	read_tmp_buf(t_vars *vars)
-{
-	int	fd;
-
-	fd = open(TMP_BUF, O_RDONLY);
-	if (fd == -1)
-	{
-		perror("bleshell: failed to open TMP_BUF file for reading");
-		vars->error_code = ERR_DEFAULT;
-		unlink(TMP_BUF);
-		return (0);
-	}
-	vars->pipes->hd_fd = fd;
-	return (1);
-}
@@ -0,0 +1,182 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   herestring.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/23 10:05:47 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/23 16:41:12 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Cuts the here-string word out of the input line.
+- The word runs to the first unquoted space or operator, quotes and
+  all, so build_herestring() can tell its quoted parts apart.
+Returns:
+- The raw word, allocated.
+- NULL if there is no word or a quote is left open.
+Works with proc_redir_filename().
+
+Example: For "cat <<< a"$X"'b c' | wc"
+- Returns: a"$X"'b c'
+*/
+char	*get_herestring_word(char *input, int *i)
+{
+	int		start;
+	char	quote;
+
+	start = *i;
+	quote = 0;
+	while (input[*i] && (quote || (!ft_isspace(input[*i])
+				&& !is_operator_token(get_token_at(input, *i, &(int){0})))))
+	{
+		if (input[*i] == quote)
+			quote = 0;
+		else if (!quote && (input[*i] == '\'' || input[*i] == '"'))
+			quote = input[*i];
+		(*i)++;
+	}
+	if (quote || *i == start)
+		return (NULL);
+	return (ft_substr(input, start, *i - start));
+}
+
+/*
+Appends a here-string word to the buffer with its quotes removed.
+- Single-quoted parts are copied as they are.
+- Double-quoted and unquoted parts get their variables expanded,
+  the same as the words of a command.
+- Each part is cut off in place with a NUL while it is expanded,
+  so the word is never copied.
+Returns:
+- 1 on success.
+- 0 on memory allocation failure.
+Works with build_herestring().
+
+Example: With X=val, for a"$X"c'$X'
+- Appends: "avalc$X"
+*/
+int	append_hs_word(t_strbuf *buf, char *word, t_vars *vars)
+{
+	int		end;
+	char	quote;
+	char	saved;
+	int		appended;
+
+	appended = 1;
+	while (*word && appended)
+	{
+		quote = 0;
+		if (*word == '\'' || *word == '"')
+			quote = *word++;
+		end = 0;
+		while (word[end] && word[end] != quote
+			&& (quote || (word[end] != '\'' && word[end] != '"')))
+			end++;
+		saved = word[end];
+		word[end] = '\0';
+		if (quote == '\'')
+			appended = ft_sb_append(buf, word, end);
+		else
+			appended = hd_expander(buf, word, vars);
+		word[end] = saved;
+		word += end + (quote && saved);
+	}
+	return (appended);
+}
+
+/*
+Builds the payload of a here-string in the heredoc write buffer.
+- Expands the word and removes its quotes with append_hs_word().
+- Adds the trailing newline bash appends to a here-string.
+Returns:
+- 1 on success.
+- 0 on memory allocation failure (sets vars->error_code).
+Works with read_herestring().
+
+Example: For "cat <<< "$USER here""
+- Buffer holds: "bleow here\n"
+*/
+int	build_herestring(t_node *hs_node, t_vars *vars)
+{
+	t_strbuf	*buf;
+
+	buf = &vars->pipes->hd_buf;
+	buf->len = 0;
+	if (!append_hs_word(buf, hs_node->args[0], vars)
+		|| !ft_sb_append(buf, "\n", 1))
+	{
+		vars->error_code = ERR_DEFAULT;
+		return (0);
+	}
+	return (1);
+}
+
+/*
+Hands a small here-string payload to the command through a pipe.
+- The whole payload fits in the pipe buffer, so it is written right
+  away and the write end closed, no writer process is needed.
+- The read end becomes the node's hd_fd.
+Returns:
+- 1 on success.
+- 0 if the pipe could not be created or written.
+*/
+int	herestring_pipe(t_node *hs_node, t_strbuf *buf)
+{
+	int		fds[2];
+	ssize_t	written;
+
+	if (pipe2(fds, O_CLOEXEC) == -1)
+		return (0);
+	written = write(fds[1], buf->buf, buf->len);
+	close(fds[1]);
+	if (written != (ssize_t)buf->len)
+	{
+		close(fds[0]);
+		return (0);
+	}
+	buf->len = 0;
+	hs_node->hd_fd = fds[0];
+	return (1);
+}
+
+/*
+Prepares the stdin of a here-string (<<<) redirection.
+- Expands the word once, when the command line is gathered.
+- Payloads of up to PIPE_BUF bytes go through a pipe.
+- Larger payloads are flushed to an anonymous heredoc store.
+- Either way the fd is kept in hs_node->hd_fd for handle_heredoc().
+Returns:
+- 1 on success.
+- 0 on failure (sets vars->error_code).
+Works with gather_heredocs().
+*/
+int	read_herestring(t_node *hs_node, t_vars *vars)
+{
+	t_strbuf	*buf;
+
+	if (!hs_node->args || !hs_node->args[0])
+	{
+		tok_syntax_error_msg("newline", vars);
+		return (0);
+	}
+	if (!build_herestring(hs_node, vars))
+		return (0);
+	buf = &vars->pipes->hd_buf;
+	if (buf->len <= PIPE_BUF && herestring_pipe(hs_node, buf))
+		return (1);
+	if (open_hd_store(vars) == -1)
+		return (0);
+	if (!flush_hd_buf(vars->pipes->hd_fd, NULL, 0, vars))
+	{
+		close_hd_store(vars);
+		return (0);
+	}
+	hs_node->hd_fd = vars->pipes->hd_fd;
+	vars->pipes->hd_fd = -1;
+	return (1);
+}
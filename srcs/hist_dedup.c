@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_dedup.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/26 10:14:02 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/26 18:37:45 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+FNV-1a hash of a history line.
+Works with the duplicate set of the history search index.
+*/
+unsigned int	hist_hash(const char *line)
+{
+	unsigned int	hash;
+
+	hash = 2166136261u;
+	while (*line)
+	{
+		hash ^= (unsigned char)*line;
+		hash *= 16777619u;
+		line++;
+	}
+	return (hash);
+}
+
+/*
+Records an entry in the duplicate set.
+- Linear probing from the hash of the entry's line.
+- Slots hold entry number + 1, 0 marks an empty slot.
+- The set is never more than half full (see hist_dedup_grow()).
+*/
+void	hist_dedup_insert(t_histidx *idx, int id)
+{
+	unsigned int	slot;
+	unsigned int	mask;
+
+	mask = idx->dedup_cap - 1;
+	slot = hist_hash(idx->entries[id]) & mask;
+	while (idx->dedup[slot])
+		slot = (slot + 1) & mask;
+	idx->dedup[slot] = id + 1;
+}
+
+/*
+Looks a line up in the duplicate set.
+Returns:
+- Number of the entry holding the same line.
+- -1 if the line is not in the index yet.
+*/
+int	hist_dedup_find(t_histidx *idx, const char *line)
+{
+	unsigned int	slot;
+	unsigned int	mask;
+	int				id;
+
+	if (!idx->dedup_cap)
+		return (-1);
+	mask = idx->dedup_cap - 1;
+	slot = hist_hash(line) & mask;
+	while (idx->dedup[slot])
+	{
+		id = idx->dedup[slot] - 1;
+		if (ft_strcmp(idx->entries[id], line) == 0)
+			return (id);
+		slot = (slot + 1) & mask;
+	}
+	return (-1);
+}
+
+/*
+Makes room in the duplicate set for one more entry.
+- Doubles the set and re-inserts every entry once it would get
+  more than half full, which keeps probe sequences short.
+Returns:
+- 1 on success.
+- 0 on allocation failure (the old set is kept).
+*/
+int	hist_dedup_grow(t_histidx *idx)
+{
+	int	*new_set;
+	int	new_cap;
+	int	id;
+
+	if ((idx->count + 1) * 2 <= idx->dedup_cap)
+		return (1);
+	new_cap = HIST_IDX_MIN * 2;
+	while (new_cap < (idx->count + 1) * 2)
+		new_cap *= 2;
+	new_set = ft_calloc(new_cap, sizeof(int));
+	if (!new_set)
+		return (0);
+	ft_safefree((void **)&idx->dedup);
+	idx->dedup = new_set;
+	idx->dedup_cap = new_cap;
+	id = 0;
+	while (id < idx->count)
+	{
+		hist_dedup_insert(idx, id);
+		id++;
+	}
+	return (1);
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_index.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/26 10:14:02 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/26 18:37:45 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Makes room for one more entry in the entry and seq arrays.
+- Doubles both arrays when they are full.
+Returns:
+- 1 on success.
+- 0 on allocation failure (the old arrays are kept).
+*/
+int	hist_entries_grow(t_histidx *idx)
+{
+	char	**new_entries;
+	int		*new_seq;
+	int		new_cap;
+
+	if (idx->count < idx->cap)
+		return (1);
+	new_cap = idx->cap * 2;
+	if (new_cap < HIST_IDX_MIN)
+		new_cap = HIST_IDX_MIN;
+	new_entries = malloc(sizeof(char *) * new_cap);
+	new_seq = malloc(sizeof(int) * new_cap);
+	if (!new_entries || !new_seq)
+	{
+		free(new_entries);
+		free(new_seq);
+		return (0);
+	}
+	ft_memcpy(new_entries, idx->entries, sizeof(char *) * idx->count);
+	ft_memcpy(new_seq, idx->seq, sizeof(int) * idx->count);
+	ft_safefree((void **)&idx->entries);
+	ft_safefree((void **)&idx->seq);
+	idx->entries = new_entries;
+	idx->seq = new_seq;
+	idx->cap = new_cap;
+	return (1);
+}
+
+/*
+Adds a history line to the search index.
+- A line already in the index is not stored again, its entry only
+  becomes the most recent one.
+- A new line gets an entry, a slot in the duplicate set and a
+  posting in the list of each of its trigrams.
+Returns:
+- 1 on success.
+- 0 on allocation failure.
+Works with run_input() and hist_index_load().
+*/
+int	hist_index_add(t_histidx *idx, char *line)
+{
+	int	id;
+
+	if (!line || !*line)
+		return (1);
+	id = hist_dedup_find(idx, line);
+	if (id < 0)
+	{
+		if (!hist_entries_grow(idx) || !hist_dedup_grow(idx))
+			return (0);
+		id = idx->count;
+		idx->entries[id] = ft_strdup(line);
+		if (!idx->entries[id])
+			return (0);
+		idx->count++;
+		hist_dedup_insert(idx, id);
+		if (!index_trigrams(idx, id))
+			return (0);
+	}
+	idx->seq[id] = idx->next_seq;
+	idx->next_seq++;
+	return (1);
+}
+
+/*
+for_each_hist_line() callback that adds a command to the index.
+*/
+void	hist_index_cb(char *cmd, void *ctx)
+{
+	hist_index_add((t_histidx *)ctx, cmd);
+}
+
+/*
+Builds the search index from the history file on first use.
+- The index is only needed by searches, so shells that never search
+  never pay for it.
+- Indexes every entry of the file, not only the HISTSIZE entries
+  readline keeps in memory.
+- Waits for the history writer first, so the commands that just ran
+  are in the file.
+- Once loaded, run_input() keeps it up to date line by line.
+Returns:
+- 1 if the index is ready.
+- 0 on allocation failure.
+*/
+int	hist_index_load(t_histidx *idx)
+{
+	char	*map;
+	size_t	len;
+
+	if (idx->loaded)
+		return (1);
+	hist_writer_wait(hist_writer_ptr(NULL));
+	idx->tri = ft_calloc((size_t)1 << HIST_TRI_BITS, sizeof(t_postings));
+	if (!idx->tri)
+		return (0);
+	idx->rs_last = -1;
+	map = map_history_file(&len);
+	if (map)
+	{
+		for_each_hist_line(map, len, hist_index_cb, idx);
+		munmap(map, len);
+	}
+	idx->loaded = 1;
+	return (1);
+}
+
+/*
+Frees the search index and everything it holds.
+Works with cleanup_vars().
+*/
+void	hist_index_free(t_histidx *idx)
+{
+	int	i;
+
+	i = 0;
+	while (i < idx->count)
+		ft_safefree((void **)&idx->entries[i++]);
+	i = 0;
+	while (idx->tri && i < (1 << HIST_TRI_BITS))
+		ft_safefree((void **)&idx->tri[i++].ids);
+	ft_safefree((void **)&idx->tri);
+	ft_safefree((void **)&idx->entries);
+	ft_safefree((void **)&idx->seq);
+	ft_safefree((void **)&idx->dedup);
+	ft_safefree((void **)&idx->rs_query);
+	ft_memset(idx, 0, sizeof(t_histidx));
+}
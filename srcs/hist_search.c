@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_search.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/26 10:14:02 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/26 18:37:45 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Checks whether an entry is a search result.
+Returns:
+- 1 if the entry contains query and was used before seq `below`.
+- 0 otherwise.
+*/
+int	hist_pick(t_histidx *idx, int id, char *query, int below)
+{
+	if (idx->seq[id] >= below)
+		return (0);
+	return (ft_strnstr(idx->entries[id], query,
+			ft_strlen(idx->entries[id])) != NULL);
+}
+
+/*
+Finds the most recently used entry containing query.
+- Only checks the entries of the query's shortest trigram posting
+  list, or every entry for queries shorter than three characters.
+- `below` limits the search to entries used before that seq, so
+  repeated searches step back through older matches.
+Returns:
+- Number of the matching entry.
+- -1 if nothing matches.
+*/
+int	hist_index_search(t_histidx *idx, char *query, int below)
+{
+	t_postings	*list;
+	int			best;
+	int			count;
+	int			id;
+	int			i;
+
+	list = shortest_postings(idx, query);
+	count = idx->count;
+	if (list)
+		count = list->count;
+	best = -1;
+	i = 0;
+	while (i < count)
+	{
+		id = i;
+		if (list)
+			id = list->ids[i];
+		if ((best < 0 || idx->seq[id] > idx->seq[best])
+			&& hist_pick(idx, id, query, below))
+			best = id;
+		i++;
+	}
+	return (best);
+}
+
+/*
+Keeps the address of the shell's history index for readline.
+- Readline key bindings only get a count and a key, so the index is
+  registered once with a non-NULL `set` and fetched with NULL.
+Returns:
+- The registered index (NULL before registration).
+*/
+t_histidx	*hist_index_ptr(t_histidx *set)
+{
+	static t_histidx	*idx;
+
+	if (set)
+		idx = set;
+	return (idx);
+}
+
+/*
+Readline command for the indexed history search (HIST_SEARCH_KEY).
+- Searches for the text on the line and replaces the line with the
+  most recent history entry containing it.
+- Pressing the key again while the result is shown steps back to
+  older matches of the same text.
+- Rings the bell when there is no (further) match.
+Returns:
+- 0 (readline convention).
+*/
+int	hist_search_key(int count, int key)
+{
+	t_histidx	*idx;
+	int			id;
+
+	(void)count;
+	(void)key;
+	idx = hist_index_ptr(NULL);
+	if (!idx || !hist_index_load(idx))
+		return (0);
+	if (idx->rs_last < 0 || !idx->rs_query
+		|| ft_strcmp(rl_line_buffer, idx->entries[idx->rs_last]) != 0)
+	{
+		ft_safefree((void **)&idx->rs_query);
+		idx->rs_query = ft_strdup(rl_line_buffer);
+		idx->rs_seq = INT_MAX;
+	}
+	id = -1;
+	if (idx->rs_query)
+		id = hist_index_search(idx, idx->rs_query, idx->rs_seq);
+	idx->rs_last = id;
+	if (id < 0)
+		return (rl_ding());
+	idx->rs_seq = idx->seq[id];
+	rl_replace_line(idx->entries[id], 0);
+	rl_point = rl_end;
+	return (0);
+}
+
+/*
+Registers the indexed history search with readline.
+- Available as "bleshell-history-search" for inputrc bindings.
+- Bound to HIST_SEARCH_KEY (Meta-p) by default.
+Works with init_shell().
+*/
+void	init_hist_search(t_vars *vars)
+{
+	hist_index_ptr(&vars->hist_idx);
+	rl_add_defun("bleshell-history-search", hist_search_key, -1);
+	rl_bind_keyseq(HIST_SEARCH_KEY, hist_search_key);
+}
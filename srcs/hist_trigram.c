@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_trigram.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/26 10:14:02 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/26 18:37:45 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Maps the three bytes at s to a trigram posting list.
+Returns:
+- List number below 1 << HIST_TRI_BITS.
+*/
+int	tri_bucket(const char *s)
+{
+	unsigned int	key;
+
+	key = ((unsigned int)(unsigned char)s[0] << 16)
+		| ((unsigned int)(unsigned char)s[1] << 8)
+		| (unsigned char)s[2];
+	return ((key * 2654435761u) >> (32 - HIST_TRI_BITS));
+}
+
+/*
+Adds an entry to a posting list.
+- Entries are indexed one after the other, so an entry that was just
+  added is the last one and is not added twice.
+Returns:
+- 1 on success.
+- 0 on allocation failure.
+*/
+int	postings_push(t_postings *list, int id)
+{
+	int	*new_ids;
+	int	new_cap;
+
+	if (list->count && list->ids[list->count - 1] == id)
+		return (1);
+	if (list->count == list->cap)
+	{
+		new_cap = list->cap * 2;
+		if (new_cap < HIST_IDX_MIN)
+			new_cap = HIST_IDX_MIN;
+		new_ids = malloc(sizeof(int) * new_cap);
+		if (!new_ids)
+			return (0);
+		if (list->count)
+			ft_memcpy(new_ids, list->ids, sizeof(int) * list->count);
+		free(list->ids);
+		list->ids = new_ids;
+		list->cap = new_cap;
+	}
+	list->ids[list->count] = id;
+	list->count++;
+	return (1);
+}
+
+/*
+Adds an entry to the posting list of each of its trigrams.
+Returns:
+- 1 on success.
+- 0 on allocation failure.
+Works with hist_index_add().
+*/
+int	index_trigrams(t_histidx *idx, int id)
+{
+	char	*line;
+	size_t	i;
+
+	line = idx->entries[id];
+	i = 0;
+	while (line[i] && line[i + 1] && line[i + 2])
+	{
+		if (!postings_push(&idx->tri[tri_bucket(line + i)], id))
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/*
+Finds the shortest posting list among the trigrams of a query.
+- Every entry containing the query is in each of these lists, so
+  only the entries of the shortest one have to be checked.
+Returns:
+- Pointer to the shortest list (which may be empty).
+- NULL if the query is shorter than a trigram.
+Works with hist_index_search() and history_print_matches().
+*/
+t_postings	*shortest_postings(t_histidx *idx, const char *query)
+{
+	t_postings	*best;
+	t_postings	*list;
+	size_t		i;
+
+	if (!query[0] || !query[1] || !query[2])
+		return (NULL);
+	best = &idx->tri[tri_bucket(query)];
+	i = 1;
+	while (query[i + 2])
+	{
+		list = &idx->tri[tri_bucket(query + i)];
+		if (list->count < best->count)
+			best = list;
+		i++;
+	}
+	return (best);
+}
@@ -6,109 +6,116 @@
 /*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/01 06:29:46 by bleow             #+#    #+#             */
-/*   Updated: 2025/06/07 02:50:50 by bleow            ###   ########.fr       */
+/*   Updated: 2025/06/25 15:08:33 by bleow            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /*
-Skips specified number of lines in an open file.
-- Reads and discards requested number of lines.
-- Uses get_next_line to properly handle line endings.
-- Ensures proper memory management during skipping.
-- Stops if end of file is reached before count is complete.
-Works with trim_history().
-Example: For a history with 1000 lines
-- skip_lines(fd, 500) skips first 500 entries
-- Positions file pointer at 501st entry
-- Properly frees all memory used during skipping
+Reads a history size limit from the environment.
+- Used for HISTSIZE (entries kept in memory) and HISTFILESIZE
+  (entries kept in the history file), read when they are needed so
+  that exporting a new value takes effect right away.
+- Only plain non-negative numbers are accepted.
+Returns:
+- The limit from the environment.
+- fallback if the variable is unset, empty or not a number.
+Works with load_history() and append_history_entry().
 */
-void	skip_lines(int fd, int count)
+int	hist_limit(const char *name, int fallback, t_vars *vars)
 {
-	char	*line;
-	int		i;
+	char	*value;
+	int		pos;
+	int		len;
+	long	limit;
 
-	i = 0;
-	while (i < count)
+	len = ft_strlen(name);
+	pos = env_index_find(vars, name, len);
+	if (pos == -1 || vars->env[pos][len] != '=' || !vars->env[pos][len + 1])
+		return (fallback);
+	value = vars->env[pos] + len + 1;
+	limit = 0;
+	while (ft_isdigit(*value) && limit <= INT_MAX)
 	{
-		line = get_next_line(fd);
-		if (!line)
-			break ;
-		ft_safefree((void **)&line);
-		i++;
+		limit = limit * 10 + (*value - '0');
+		value++;
 	}
+	if (*value || limit > INT_MAX)
+		return (fallback);
+	return ((int)limit);
 }
 
 /*
-Opens history file with appropriate access mode.
-- Checks if history file exists and has required permissions.
-- Creates new history file with proper permissions if needed.
-- Opens file with requested mode (read or write).
+Appends a non-negative number in decimal to a string buffer.
 Returns:
-File descriptor for history file or -1 on error.
-Works with load_history() and save_history().
-Example: init_history_fd(O_RDONLY)
-- Checks if HISTORY_FILE exists and is readable
-- Opens it for reading if exists and accessible
-- Returns file descriptor or -1 on failure
+- 1 on success.
+- 0 on memory allocation failure.
+Works with format_hist_entry().
 */
-int	init_history_fd(int mode)
+int	hist_put_num(t_strbuf *sb, long n)
 {
-	int			fd;
-	struct stat	st;
+	char	digits[24];
+	int		i;
 
-	ft_memset(&st, 0, sizeof(st));
-	if (stat("temp", &st) == -1)
+	if (n < 0)
+		n = 0;
+	i = 24;
+	while (i == 24 || n > 0)
 	{
-		mkdir("temp", 0755);
+		i--;
+		digits[i] = '0' + n % 10;
+		n /= 10;
 	}
-	if (access(HISTORY_FILE, F_OK) == -1)
-	{
-		fd = open(HISTORY_FILE, O_WRONLY | O_CREAT, 0644);
-		if (fd == -1)
-			return (-1);
-		close(fd);
-	}
-	if (mode == O_RDONLY && access(HISTORY_FILE, R_OK) == -1)
-		return (-1);
-	if (mode == O_WRONLY && access(HISTORY_FILE, W_OK) == -1)
-		return (-1);
-	fd = open(HISTORY_FILE, mode);
-	return (fd);
+	return (ft_sb_append(sb, digits + i, 24 - i));
 }
 
 /*
-Counts the number of lines in the history file.
-- Opens history file for reading.
-- Reads each line using get_next_line() until EOF.
-- Counts each line and properly frees memory.
+Builds one history file entry in the extended format
+": <start>:<duration>:<status>;<command>\n".
+- start is the time the command was read, duration is in seconds
+  and status is the exit code the command left.
 Returns:
-Total count of history entries in the file.
-0 if file cannot be opened or is empty.
-Works with load_history() and trim_history().
+- 1 on success.
+- 0 on memory allocation failure.
+Works with append_history_entry().
 
-Example: If history file contains 100 commands
-- Returns 100 after counting all lines
-- Returns 0 if file doesn't exist or can't be opened
+Example: "ls -la" read at 1718000000, ran for 2 seconds, exit code 0
+- Entry: ": 1718000000:2:0;ls -la\n"
 */
-int	get_history_count(void)
+int	format_hist_entry(t_strbuf *sb, char *line, time_t start, int status)
 {
-	int		fd;
-	int		count;
-	char	*line;
+	return (ft_sb_append(sb, ": ", 2)
+		&& hist_put_num(sb, start)
+		&& ft_sb_append(sb, ":", 1)
+		&& hist_put_num(sb, time(NULL) - start)
+		&& ft_sb_append(sb, ":", 1)
+		&& hist_put_num(sb, status)
+		&& ft_sb_append(sb, ";", 1)
+		&& ft_sb_append(sb, line, ft_strlen(line))
+		&& ft_sb_append(sb, "\n", 1));
+}
 
-	count = 0;
-	fd = init_history_fd(O_RDONLY);
-	if (fd == -1)
-		return (0);
-	line = get_next_line(fd);
-	while (line)
-	{
-		count++;
-		ft_safefree((void **)&line);
-		line = get_next_line(fd);
-	}
-	close(fd);
-	return (count);
+/*
+Finds the command part of a history file line.
+- Skips the ": <start>:<duration>:<status>;" prefix of an extended
+  entry.
+- Lines without that prefix (older history files) are commands
+  as a whole.
+Returns:
+- Pointer to the first character of the command.
+Works with add_hist_lines().
+*/
+char	*hist_entry_cmd(char *line, char *end)
+{
+	char	*pos;
+
+	if (end - line < 3 || line[0] != ':' || line[1] != ' ')
+		return (line);
+	pos = line + 2;
+	while (pos < end && (ft_isdigit(*pos) || *pos == ':'))
+		pos++;
+	if (pos < end && *pos == ';')
+		return (pos + 1);
+	return (line);
 }
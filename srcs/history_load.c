@@ -6,79 +6,128 @@
 /*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/03 12:48:27 by bleow             #+#    #+#             */
-/*   Updated: 2025/06/07 02:49:52 by bleow            ###   ########.fr       */
+/*   Updated: 2025/06/25 15:08:33 by bleow            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /*
-Reads history lines from file descriptor and adds to readline history.
-- Gets lines one by one using get_next_line().
-- Removes trailing newlines from each history entry.
-- Adds non-empty lines to readline's history memory.
-- Properly frees memory for each processed line.
-Returns:
-Nothing (void function).
-Works with load_history() after skip_history_lines().
+Calls fn on the command part of each history file line in data.
+- Walks the lines in order, stripping the timestamp of each entry.
+- Empty commands are skipped.
+Works with load_history() and hist_index_load().
 
-Example: After skipping excess lines
-- Reads remaining lines like "ls -la", "cd .."
-- Adds each valid entry to readline history
-- Stops at EOF, leaving history populated with latest commands
+Example: For ": 1718000000:0:0;ls -la\ncd ..\n"
+- Calls fn with "ls -la", then with "cd .."
 */
-void	read_history_lines(int fd)
+void	for_each_hist_line(char *data, size_t len, t_histline_fn fn,
+			void *ctx)
 {
-	char	*line;
-	size_t	len;
+	char	*end;
+	char	*line_end;
+	char	*cmd;
 
-	line = get_next_line(fd);
-	while (line)
+	end = data + len;
+	while (data < end)
 	{
-		if (*line)
+		line_end = ft_memchr(data, '\n', end - data);
+		if (!line_end)
+			line_end = end;
+		cmd = hist_entry_cmd(data, line_end);
+		if (cmd < line_end)
 		{
-			len = ft_strlen(line);
-			if (len > 0 && line[len - 1] == '\n')
-				line[len - 1] = '\0';
-			add_history(line);
+			cmd = ft_strndup(cmd, line_end - cmd);
+			if (cmd)
+				fn(cmd, ctx);
+			ft_safefree((void **)&cmd);
 		}
-		ft_safefree((void **)&line);
-		line = get_next_line(fd);
+		data = line_end + 1;
 	}
 }
 
 /*
-Loads command history from file into readline's history memory.
-- Counts total history entries to determine if skipping is needed.
-- Skips older entries if count exceeds HIST_MEM_MAX limit.
-- Reads remaining entries into readline history memory.
-- Handles file opening/closing and empty history cases.
-Returns:
-Nothing (void function).
-Works with init_shell() during program startup.
+for_each_hist_line() callback that adds a command to readline history.
+*/
+void	add_history_cb(char *cmd, void *ctx)
+{
+	(void)ctx;
+	add_history(cmd);
+}
 
-Example: For a shell with HIST_MEM_MAX=1000
-- Checks history file size
-- If 1500 entries exist, skips first 500
-- Loads most recent 1000 entries into memory
-- Returns without action if history is empty or inaccessible
+/*
+Opens the history directory once, at startup.
+- HISTORY_DIR is resolved against the directory the shell started
+  in and created when missing. Every later access to the history
+  files goes through the kept fd, so a `cd` changes none of them.
+- When it cannot be opened the shell runs without a history file.
+Works with init_input().
 */
-void	load_history(void)
+void	hist_dir_open(void)
 {
-	int		fd;
-	int		count;
-	int		skip;
+	int	fd;
 
-	count = get_history_count();
-	if (count == 0)
+	if (mkdir(HISTORY_DIR, 0755) == -1 && errno != EEXIST)
 		return ;
-	fd = init_history_fd(O_RDONLY);
+	fd = open(HISTORY_DIR, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (fd != -1)
+		hist_dir_fd(fd);
+}
+
+/*
+Maps the history file read-only.
+Returns:
+- Pointer to the mapped file, its size stored in len.
+- NULL if the file is missing, empty or cannot be mapped.
+Works with load_history() and hist_index_load().
+*/
+char	*map_history_file(size_t *len)
+{
+	int			fd;
+	struct stat	st;
+	char		*map;
+
+	fd = openat(hist_dir_fd(-1), HISTORY_FILE, O_RDONLY | O_CLOEXEC);
 	if (fd == -1)
-		return ;
-	skip = 0;
-	if (count > HIST_MEM_MAX)
-		skip = count - HIST_MEM_MAX;
-	skip_lines(fd, skip);
-	read_history_lines(fd);
+		return (NULL);
+	if (fstat(fd, &st) == -1 || st.st_size <= 0)
+	{
+		close(fd);
+		return (NULL);
+	}
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
 	close(fd);
+	if (map == MAP_FAILED)
+		return (NULL);
+	*len = st.st_size;
+	return (map);
+}
+
+/*
+Loads command history from file into readline's history memory.
+- Maps the history file and scans backwards from its end for the
+  last HISTSIZE entries, so only those entries are ever read and
+  startup does not grow with the size of the file.
+- Limits readline's history to HISTSIZE entries.
+Works with init_shell() during program startup.
+
+Example: For HISTSIZE=1000 and a file of 100k entries
+- Finds the start of the last 1000 entries from the end of the map
+- Adds those 1000 entries to readline history
+*/
+void	load_history(t_vars *vars)
+{
+	int		histsize;
+	char	*map;
+	size_t	len;
+	size_t	start;
+
+	histsize = hist_limit("HISTSIZE", HIST_MEM_MAX, vars);
+	stifle_history(histsize);
+	map = map_history_file(&len);
+	if (!map)
+		return ;
+	start = hist_keep_start(map, len, histsize);
+	for_each_hist_line(map + start, len - start, add_history_cb, NULL);
+	munmap(map, len);
 }
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_queue.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/27 11:02:16 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/27 19:48:03 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Hands a formatted history entry to the writer thread.
+- Takes ownership of data, the writer frees it once written.
+- Only the shell's main thread pushes, so head needs no lock. The
+  release store publishes the slot before the writer can see it.
+- Never touches the disk. Only if the writer fell HIST_QUEUE_SZ
+  entries behind does it wait for a free slot.
+Works with append_history_entry().
+*/
+void	hist_queue_push(t_histwr *wr, char *data, size_t len, int keep)
+{
+	size_t		head;
+	t_histmsg	*msg;
+	uint64_t	one;
+
+	one = 1;
+	head = atomic_load_explicit(&wr->head, memory_order_relaxed);
+	while (head - atomic_load_explicit(&wr->tail, memory_order_acquire)
+		>= HIST_QUEUE_SZ)
+	{
+		write(wr->efd, &one, sizeof(one));
+		usleep(HIST_WAIT_US);
+	}
+	msg = &wr->ring[head & (HIST_QUEUE_SZ - 1)];
+	msg->data = data;
+	msg->len = len;
+	msg->keep = keep;
+	atomic_store_explicit(&wr->head, head + 1, memory_order_release);
+	write(wr->efd, &one, sizeof(one));
+}
+
+/*
+Appends a batch of entries to the history file with one write().
+- Same flock() protocol as the shell's own appends, so shells
+  sharing the file never interleave partial lines.
+- open_history_locked() publishes the fd in lock_fd for the fork
+  handler.
+- The file is opened through the history directory fd, so a batch
+  queued before a `cd` still lands in the startup directory.
+- Leaves the fsync() to hist_writer_sync().
+Works with hist_queue_drain() and append_history_entry().
+*/
+void	hist_batch_flush(t_histwr *wr, t_strbuf *batch)
+{
+	int	fd;
+
+	if (!batch->len)
+		return ;
+	fd = open_history_locked(O_WRONLY | O_APPEND);
+	if (fd != -1)
+	{
+		write(fd, batch->buf, batch->len);
+		close_history_locked(fd);
+		wr->dirty = 1;
+	}
+	batch->len = 0;
+}
+
+/*
+Writes every queued entry to the history file.
+- Collects the entries into one batch and frees them, each slot is
+  released to the shell as soon as it was handled.
+- Runs a requested compaction after writing the entries before it.
+- Updates done once the entries are in the file.
+Works with hist_writer_main().
+*/
+void	hist_queue_drain(t_histwr *wr)
+{
+	t_strbuf	batch;
+	t_histmsg	*msg;
+	size_t		tail;
+
+	ft_memset(&batch, 0, sizeof(t_strbuf));
+	tail = atomic_load_explicit(&wr->tail, memory_order_relaxed);
+	while (tail != atomic_load_explicit(&wr->head, memory_order_acquire))
+	{
+		msg = &wr->ring[tail & (HIST_QUEUE_SZ - 1)];
+		if (!ft_sb_append(&batch, msg->data, msg->len))
+		{
+			hist_batch_flush(wr, &batch);
+			ft_sb_append(&batch, msg->data, msg->len);
+		}
+		if (msg->keep >= 0)
+		{
+			hist_batch_flush(wr, &batch);
+			compact_history(msg->keep);
+		}
+		ft_safefree((void **)&msg->data);
+		atomic_store_explicit(&wr->tail, ++tail, memory_order_release);
+	}
+	hist_batch_flush(wr, &batch);
+	ft_sb_free(&batch);
+	atomic_store(&wr->done, tail);
+}
+
+/*
+Syncs written history entries to disk.
+- Any fd of the file will do, fsync() flushes the file itself.
+- Opens it through hist_dir_fd(), not the shell's current directory.
+- Does nothing when nothing was written since the last sync.
+Works with hist_writer_main().
+*/
+void	hist_writer_sync(t_histwr *wr)
+{
+	int	fd;
+
+	if (!wr->dirty)
+		return ;
+	fd = openat(hist_dir_fd(-1), HISTORY_FILE, O_WRONLY | O_CLOEXEC);
+	if (fd != -1)
+	{
+		fsync(fd);
+		close(fd);
+	}
+	wr->dirty = 0;
+}
+
+/*
+Waits until every pushed entry is in the history file.
+- Lets readers of the file, like the search index, see the commands
+  that just ran.
+- Returns at once when the writer is not running.
+Works with hist_index_load().
+*/
+void	hist_writer_wait(t_histwr *wr)
+{
+	if (!wr)
+		return ;
+	while (wr->active && atomic_load(&wr->done) != atomic_load(&wr->head))
+		usleep(HIST_WAIT_US);
+}
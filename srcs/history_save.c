@@ -6,115 +6,153 @@
 /*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/02 14:35:22 by bleow             #+#    #+#             */
-/*   Updated: 2025/05/22 17:17:31 by bleow            ###   ########.fr       */
+/*   Updated: 2025/06/25 15:08:33 by bleow            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /*
-Prepares history entries for saving, handling excess lines.
-- Retrieves history entries from readline's memory.
-- Calculates start index based on history limit.
-- Returns all info needed for saving entries.
+Opens the history file and takes an exclusive flock() on it.
+- Opens HISTORY_FILE in the history directory, see hist_dir_fd(),
+  and creates it when missing.
+- Checks that the locked file is still the one at HISTORY_FILE.
+  A compaction may have renamed a new file into place while this
+  shell waited for the lock, in which case it opens the new one.
+- Publishes the fd in the writer's lock_fd as soon as it is open,
+  see hist_lock_publish().
 Returns:
-- Start index for entry saving
-- History list via parameter
-- Total count via parameter
-- 1 on success, 0 on failure
-Works with save_history().
+- Locked file descriptor, release it with close_history_locked().
+- -1 on failure.
+Works with append_history_entry() and compact_history().
 */
-int	prepare_history_entries(HIST_ENTRY ***hist_list, int *history_count
-					, int *start_idx)
+int	open_history_locked(int flags)
 {
-	int	excess_lines;
+	int			fd;
+	int			dir;
+	struct stat	fd_st;
+	struct stat	path_st;
 
-	*hist_list = history_list();
-	if (!*hist_list)
-		return (0);
-	*history_count = history_length;
-	excess_lines = *history_count - HISTORY_FILE_MAX;
-	*start_idx = 0;
-	if (excess_lines > 0)
-		*start_idx = excess_lines;
-	return (1);
+	dir = hist_dir_fd(-1);
+	while (1)
+	{
+		fd = openat(dir, HISTORY_FILE, flags | O_CREAT | O_CLOEXEC, 0644);
+		if (fd == -1)
+			return (-1);
+		hist_lock_publish(fd);
+		if (flock(fd, LOCK_EX) == -1 || fstat(fd, &fd_st) == -1)
+			break ;
+		if (fstatat(dir, HISTORY_FILE, &path_st, 0) == 0
+			&& path_st.st_ino == fd_st.st_ino
+			&& path_st.st_dev == fd_st.st_dev)
+			return (fd);
+		close_history_locked(fd);
+	}
+	close_history_locked(fd);
+	return (-1);
 }
 
 /*
-Saves readline history entries to history file.
-- Opens history file for writing.
-- Retrieves history entries from readline's memory.
-- Skips excess entries if count exceeds HISTORY_FILE_MAX.
-- Writes valid entries to history file with newlines.
-- Logs details of the save operation for debugging.
-Works with cleanup_exit() during shell termination.
-
-Example: When shell exits with 1500 history entries and HISTORY_FILE_MAX=1000
-- Opens history file for writing (creating if needed)
-- Calculates excess entries (500)
-- Skips oldest 500 entries
-- Writes newest 1000 entries to history file
-- Logs success with number of entries saved
+Records a finished command in the history file.
+- Formats one extended entry (start time, duration, exit status).
+- Hands it to the background writer, so the prompt never waits on
+  the disk. The writer appends it under the history lock, so shells
+  sharing the file never mix up or overwrite each other's lines.
+- Without a writer, appends it here with hist_batch_flush().
+- Every HIST_COMPACT_INTERVAL entries, trims the file to HISTFILESIZE
+  entries with compact_history(). keep stays -1 in between, so that
+  HISTFILESIZE=0 still empties the file.
+Works with run_input().
 */
-void	save_history(void)
+void	append_history_entry(char *line, time_t start, t_vars *vars)
 {
-	int			fd;
-	HIST_ENTRY	**hist_list;
-	int			history_count;
-	int			start_idx;
-	int			saved_count;
+	static int	appended;
+	t_strbuf	entry;
+	int			keep;
 
-	if (!chk_and_make_folder("temp"))
+	if (!ft_sb_init(&entry, ft_strlen(line) + 48))
 		return ;
-	fd = open(HISTORY_FILE, O_WRONLY | O_CREAT | O_TRUNC, 0644);
-	if (fd == -1)
-		return ;
-	if (!prepare_history_entries(&hist_list, &history_count, &start_idx))
+	keep = -1;
+	if (++appended % HIST_COMPACT_INTERVAL == 0)
+		keep = hist_limit("HISTFILESIZE", HISTORY_FILE_MAX, vars);
+	if (!format_hist_entry(&entry, line, start, vars->error_code))
+		entry.len = 0;
+	if (vars->hist_wr.active)
 	{
-		close(fd);
+		hist_queue_push(&vars->hist_wr, entry.buf, entry.len, keep);
 		return ;
 	}
-	saved_count = save_history_entries(fd, hist_list, start_idx,
-			history_count);
-	close(fd);
-	if (saved_count > HISTORY_FILE_MAX)
-	{
-		trim_history(saved_count - HISTORY_FILE_MAX);
-	}
+	hist_batch_flush(&vars->hist_wr, &entry);
+	ft_sb_free(&entry);
+	if (keep >= 0)
+		compact_history(keep);
 }
 
 /*
-Writes history entries to the history file.
-- Iterates through history entries starting at specified index.
-- Writes valid entries to file with newlines.
-- Tracks number of entries saved for debugging.
-- Logs detailed save information for troubleshooting.
+Finds where the last `keep` lines of a history buffer start.
+- Scans backwards from the end, ignoring the final newline, so only
+  the kept lines are ever looked at.
 Returns:
-Number of entries successfully saved.
-Works with save_history().
-
-Example: For 1000 history entries after skipping 200
-- Iterates through entries 200-999
-- Writes each valid entry with a newline
-- Logs progress during save operation
-- Returns total count of entries saved (should be 800)
+- Offset of the first line to keep.
+- 0 if the buffer holds no more than `keep` lines.
+- len if no line is to be kept.
+Works with compact_history() and load_history().
 */
-int	save_history_entries(int fd, HIST_ENTRY **hist_list, int start, int total)
+size_t	hist_keep_start(char *buf, size_t len, int keep)
 {
-	int	i;
-	int	saved_count;
+	size_t	i;
+	int		lines;
 
-	saved_count = 0;
-	i = start;
-	while (i < total && hist_list[i])
+	if (len == 0)
+		return (0);
+	if (keep <= 0)
+		return (len);
+	lines = 0;
+	i = len - 1;
+	while (i > 0)
 	{
-		if (hist_list[i]->line && *(hist_list[i]->line))
+		i--;
+		if (buf[i] == '\n')
 		{
-			saved_count++;
-			write(fd, hist_list[i]->line, strlen(hist_list[i]->line));
-			write(fd, "\n", 1);
+			lines++;
+			if (lines == keep)
+				return (i + 1);
 		}
-		i++;
 	}
-	return (saved_count);
+	return (0);
+}
+
+/*
+Trims the history file to its newest `keep` entries.
+- Runs under the history lock, so appends from other shells wait
+  for it instead of being lost.
+- Writes the kept lines to HISTORY_FILE_TMP and renames it over the
+  history file, which replaces the file atomically.
+- Does nothing when the file is within its limit.
+- A keep of 0 empties the file.
+Works with append_history_entry().
+
+Example: With keep=2000 and 2064 entries in the file
+- Writes the newest 2000 entries to HISTORY_FILE_TMP
+- Renames HISTORY_FILE_TMP to HISTORY_FILE
+*/
+void	compact_history(int keep)
+{
+	int		fd;
+	char	*buf;
+	size_t	len;
+	size_t	start;
+
+	fd = open_history_locked(O_RDONLY);
+	if (fd == -1)
+		return ;
+	buf = read_history_file(fd, &len);
+	if (buf)
+	{
+		start = hist_keep_start(buf, len, keep);
+		if (start > 0)
+			write_compacted(buf + start, len - start);
+		ft_safefree((void **)&buf);
+	}
+	close_history_locked(fd);
 }
@@ -6,157 +6,126 @@
 /*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/24 06:15:43 by bleow             #+#    #+#             */
-/*   Updated: 2025/06/07 02:50:50 by bleow            ###   ########.fr       */
+/*   Updated: 2025/06/24 11:52:09 by bleow            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minishell.h"
 
 /*
-Trims history file to maximum allowed size.
-- Opens history file for reading.
-- Skips oldest entries if file exceeds size limit.
-- Copies remaining entries to temporary file.
-- Replaces original file with trimmed version.
-- Removes temporary file after successful operation.
+Keeps the history directory fd for the whole session.
+- The history files are always opened, checked and renamed relative
+  to this fd with the *at() calls, so a `cd` in the shell never moves
+  them, not even for entries the writer thread still has queued.
+- The writer thread and the search index get no t_vars, so the fd is
+  registered once with a non-negative `set` and fetched with -1.
 Returns:
-Nothing (void function).
-Works with save_history().
-
-Example: If HISTORY_FILE_MAX=1000 and file has 1200 entries
-- Skips first 200 entries (oldest commands)
-- Copies newest 1000 entries to temporary file
-- Replaces original history file with trimmed version
-- Maintains history file within configured size limit
+- The directory fd, -1 before hist_dir_open() or if it failed.
 */
-void	trim_history(int excess_lines)
+int	hist_dir_fd(int set)
 {
-	int	fd;
+	static int	dir_fd = -1;
 
-	fd = init_history_fd(O_RDONLY);
-	if (fd == -1)
-		return ;
-	skip_lines(fd, excess_lines);
-	if (!copy_to_temp(fd))
-	{
-		close(fd);
-		return ;
-	}
-	close(fd);
-	if (copy_file(HISTORY_FILE_TMP, HISTORY_FILE))
-		unlink(HISTORY_FILE_TMP);
+	if (set >= 0)
+		dir_fd = set;
+	return (dir_fd);
 }
 
 /*
-Ensures a directory exists, creating it if needed.
-Returns 1 on success, 0 if directory creation failed.
+Reads the whole history file into memory.
+- Sizes the buffer from fstat() and reads until it is full or EOF.
+Returns:
+- Allocated buffer (not NUL terminated), its length in *len.
+- NULL on empty file or any error.
+Works with compact_history().
 */
-int	chk_and_make_folder(const char *path)
+char	*read_history_file(int fd, size_t *len)
 {
 	struct stat	st;
+	char		*buf;
+	ssize_t		bytes;
 
-	ft_memset(&st, 0, sizeof(st));
-	if (stat(path, &st) == -1)
+	*len = 0;
+	if (fstat(fd, &st) == -1 || st.st_size <= 0)
+		return (NULL);
+	buf = malloc(st.st_size);
+	if (!buf)
+		return (NULL);
+	bytes = 1;
+	while (*len < (size_t)st.st_size && bytes > 0)
 	{
-		return (mkdir(path, 0755) == 0);
+		bytes = read(fd, buf + *len, st.st_size - *len);
+		if (bytes > 0)
+			*len += bytes;
 	}
-	return (1);
+	if (bytes < 0)
+		ft_safefree((void **)&buf);
+	return (buf);
 }
 
 /*
-Helper function to perform actual file copy operation.
-- Reads from source file in chunks of 4096 bytes.
-- Writes each chunk to destination file.
-- Continues until entire file is copied.
+Replaces the history file with the given lines.
+- Writes them to HISTORY_FILE_TMP and syncs it to disk.
+- Renames HISTORY_FILE_TMP over HISTORY_FILE, so a crash leaves either
+  the old or the new file, never a partial one.
+- Both live in the history directory, see hist_dir_fd().
 Returns:
-1 on successful copy, 0 on any read/write error.
-Works with copy_file().
-
-Example: For a 10KB history file
-- Reads file in ~3 chunks of 4096 bytes
-- Writes each chunk to destination
-- Returns 1 when complete copy is successful
+1 on success, 0 on any error (the old file is kept).
+Works with compact_history().
 */
-int	copy_file_content(int fd_src, int fd_dst)
+int	write_compacted(char *data, size_t len)
 {
-	char	buffer[4096];
-	ssize_t	bytes;
+	int		fd;
+	int		dir;
+	ssize_t	written;
 
-	bytes = read(fd_src, buffer, 4096);
-	while (bytes > 0)
+	dir = hist_dir_fd(-1);
+	fd = openat(dir, HISTORY_FILE_TMP,
+			O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd == -1)
+		return (0);
+	written = write(fd, data, len);
+	if (written != (ssize_t)len || fsync(fd) == -1)
+	{
+		close(fd);
+		unlinkat(dir, HISTORY_FILE_TMP, 0);
+		return (0);
+	}
+	close(fd);
+	if (renameat(dir, HISTORY_FILE_TMP, dir, HISTORY_FILE) == -1)
 	{
-		if (write(fd_dst, buffer, bytes) == -1)
-			return (0);
-		bytes = read(fd_src, buffer, 4096);
+		unlinkat(dir, HISTORY_FILE_TMP, 0);
+		return (0);
 	}
-	return (bytes >= 0);
+	return (1);
 }
 
 /*
-Copies file contents from source to destination.
-- Opens source file for reading.
-- Opens destination file for writing (creates if needed).
-- Calls copy_file_content to perform the actual copy.
-- Ensures proper cleanup of file descriptors.
-Returns:
-1 on successful copy, 0 on any error.
-Works with trim_history().
-
-Example: copy_file(HISTORY_FILE_TMP, HISTORY_FILE)
-- Copies from temporary history file to main history file
-- Creates or overwrites destination file with source content
-- Returns 1 on successful operation
+Publishes the history fd held by the writer thread in lock_fd.
+- Set right after open(), before flock(), so a fork() at any point
+  while the fd is open lets the atfork child handler close it.
+- Does nothing before the writer is registered.
+Works with open_history_locked() and close_history_locked().
 */
-int	copy_file(const char *src, const char *dst)
+void	hist_lock_publish(int fd)
 {
-	int	fd_src;
-	int	fd_dst;
-	int	result;
+	t_histwr	*wr;
 
-	fd_src = open(src, O_RDONLY);
-	if (fd_src == -1)
-		return (0);
-	fd_dst = open(dst, O_WRONLY | O_CREAT | O_TRUNC, 0644);
-	if (fd_dst == -1)
-	{
-		close(fd_src);
-		return (0);
-	}
-	result = copy_file_content(fd_src, fd_dst);
-	close(fd_src);
-	close(fd_dst);
-	return (result);
+	wr = hist_writer_ptr(NULL);
+	if (wr)
+		atomic_store(&wr->lock_fd, fd);
 }
 
 /*
-Copies lines to temporary history file for safe operations.
-- Reads lines one by one from source file descriptor.
-- Writes each line to temporary file with newline.
-- Provides safety during history file manipulation.
-Returns:
-1 on successful copy, 0 on any error.
-Works with trim_history().
-
-Example: During history trimming
-- Copies newer history entries to temporary file
-- Protects against data corruption during manipulation
-- Returns 1 when temporary file is ready for use
+Releases a history fd from open_history_locked().
+- Unlocks first, so a child forked before lock_fd is cleared only
+  inherits an unlocked fd.
+- Clears lock_fd before the fd number can be reused by close().
+Works with hist_batch_flush() and compact_history().
 */
-int	copy_to_temp(int fd_read)
+void	close_history_locked(int fd)
 {
-	int		fd_write;
-	char	*line;
-
-	fd_write = open(HISTORY_FILE_TMP, O_WRONLY | O_CREAT | O_TRUNC, 0644);
-	if (fd_write == -1)
-		return (0);
-	line = get_next_line(fd_read);
-	while (line)
-	{
-		write(fd_write, line, ft_strlen(line));
-		ft_safefree((void **)&line);
-		line = get_next_line(fd_read);
-	}
-	close(fd_write);
-	return (1);
+	flock(fd, LOCK_UN);
+	hist_lock_publish(-1);
+	close(fd);
 }
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_writer.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/27 11:02:16 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/27 19:48:03 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Keeps the address of the shell's history writer.
+- fork() handlers and the search index get no t_vars, so the writer
+  is registered once with a non-NULL `set` and fetched with NULL.
+Returns:
+- The registered writer (NULL before registration).
+*/
+t_histwr	*hist_writer_ptr(t_histwr *set)
+{
+	static t_histwr	*wr;
+
+	if (set)
+		wr = set;
+	return (wr);
+}
+
+/*
+pthread_atfork() child handler.
+- Only the forking thread exists in the child, so the writer is
+  marked inactive there: the child never pushes, flushes or joins,
+  and leaves the queue and any half-built batch untouched.
+- Closes the history fd if the writer had it open at fork time,
+  locked or about to be, so a long-running child cannot keep other
+  shells locked out.
+- The queue needs no mutex, so there is none left locked either.
+*/
+void	hist_writer_atfork_child(void)
+{
+	t_histwr	*wr;
+	int			fd;
+
+	wr = hist_writer_ptr(NULL);
+	if (!wr || !wr->active)
+		return ;
+	wr->active = 0;
+	fd = atomic_load(&wr->lock_fd);
+	if (fd != -1)
+		close(fd);
+	close(wr->efd);
+	wr->efd = -1;
+}
+
+/*
+Writer thread main loop.
+- Sleeps on the eventfd until entries are pushed, then writes all
+  queued entries as one batch.
+- fsync()s once no entry came in for HIST_SYNC_MS after a write,
+  so a burst of commands costs a single sync.
+- On stop, drains what is left and syncs before returning.
+Works with hist_writer_start().
+*/
+void	*hist_writer_main(void *arg)
+{
+	t_histwr		*wr;
+	struct pollfd	pfd;
+	uint64_t		val;
+	int				timeout;
+
+	wr = (t_histwr *)arg;
+	pfd.fd = wr->efd;
+	pfd.events = POLLIN;
+	while (!atomic_load(&wr->stop))
+	{
+		timeout = -1;
+		if (wr->dirty)
+			timeout = HIST_SYNC_MS;
+		if (poll(&pfd, 1, timeout) == 0)
+			hist_writer_sync(wr);
+		else if (read(wr->efd, &val, sizeof(val)) < 0 && errno != EAGAIN)
+			break ;
+		hist_queue_drain(wr);
+	}
+	hist_queue_drain(wr);
+	hist_writer_sync(wr);
+	return (NULL);
+}
+
+/*
+Starts the background history writer.
+- The thread runs with every signal blocked, so signal handlers keep
+  running on the shell's main thread.
+- When the thread cannot be started the writer stays inactive and
+  append_history_entry() writes entries itself.
+Works with init_shell().
+*/
+void	hist_writer_start(t_vars *vars)
+{
+	t_histwr	*wr;
+	sigset_t	all;
+	sigset_t	old;
+
+	wr = &vars->hist_wr;
+	atomic_store(&wr->lock_fd, -1);
+	wr->efd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (wr->efd == -1)
+		return ;
+	hist_writer_ptr(wr);
+	pthread_atfork(NULL, NULL, hist_writer_atfork_child);
+	sigfillset(&all);
+	pthread_sigmask(SIG_SETMASK, &all, &old);
+	if (pthread_create(&wr->thread, NULL, hist_writer_main, wr) == 0)
+		wr->active = 1;
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+	if (wr->active)
+		return ;
+	close(wr->efd);
+	wr->efd = -1;
+}
+
+/*
+Stops the background history writer.
+- Wakes the thread, which writes and syncs every queued entry
+  before it exits, then waits for it.
+- Does nothing in forked children or when the writer never started.
+Works with cleanup_exit().
+*/
+void	hist_writer_stop(t_histwr *wr)
+{
+	uint64_t	one;
+
+	if (!wr->active)
+		return ;
+	one = 1;
+	atomic_store(&wr->stop, 1);
+	write(wr->efd, &one, sizeof(one));
+	pthread_join(wr->thread, NULL);
+	wr->active = 0;
+	close(wr->efd);
+	wr->efd = -1;
+}
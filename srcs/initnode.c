@@ -30,6 +30,8 @@ int	make_nodeframe(t_node *node, t_tokentype type, char *token)
 	node->right = NULL;
 	node->redir = NULL;
 	node->arg_quote_type = NULL;
+	node->hd_fd = -1;
+	node->hd_expand = 0;
 	if (!token)
 		token = (char *)get_token_str(type);
 	make_node_arrays(node, token);
@@ -61,25 +63,26 @@ void	set_quote_type(t_node *node, int quote_type)
 /*
 Initializes a token node with the given type and content
 Sets up character-level quote tracking when appropriate
+The node, its args and arg_quote_type vectors and the quote types
+of each argument live in the per-command arena and are released by
+cleanup_token_list(), only the argument strings are heap allocated.
 */
-t_node	*initnode(t_tokentype type, char *token)
+t_node	*initnode(t_tokentype type, char *token, t_vars *vars)
 {
 	t_node	*node;
 	int		quote_type;
 
 	quote_type = 0;
-	node = malloc(sizeof(t_node));
+	node = arena_alloc(&vars->arena, sizeof(t_node));
 	if (!node)
 		return (NULL);
+	node->arena = &vars->arena;
 	if (type == TYPE_SINGLE_QUOTE)
 		quote_type = TYPE_SINGLE_QUOTE;
 	else if (type == TYPE_DOUBLE_QUOTE)
 		quote_type = TYPE_DOUBLE_QUOTE;
 	if (!make_nodeframe(node, type, token))
-	{
-		ft_safefree((void **)&node);
 		return (NULL);
-	}
 	if (type == TYPE_SINGLE_QUOTE || type == TYPE_DOUBLE_QUOTE)
 		set_quote_type(node, quote_type);
 	return (node);
@@ -14,20 +14,20 @@
 
 /*
 Initializes the shell environment and variables.
-- Sets up signal handlers.
 - Initializes environment variables.
-- Sets up shell history.
-- Prepares the command prompt.
+- Sets up signals, the line editor and shell history, or reads a
+  script, a -c string or non-terminal stdin without them.
 Works with main() as program entry point.
 */
-void	init_shell(t_vars *vars, char **envp)
+void	init_shell(t_vars *vars, int argc, char **argv, char **envp)
 {
 	ft_memset(vars, 0, sizeof(t_vars));
 	vars->env = dup_env(envp);
-	if (!vars->env)
-	{
+	if (vars->env)
+		vars->env_len = ft_arrlen(vars->env);
+	vars->env_cap = vars->env_len + 1;
+	if (!vars->env || !build_env_index(vars))
 		crit_error(vars);
-	}
 	get_shell_level(vars);
 	incr_shell_level(vars);
 	init_vars(vars);
@@ -36,10 +36,8 @@ void	init_shell(t_vars *vars, char **envp)
 	{
 		crit_error(vars);
 	}
-	setup_terminal_mode(vars);
 	vars->error_code = 0;
-	load_signals();
-	load_history();
+	init_input(vars, argc, argv);
 }
 
 /*
@@ -70,6 +68,7 @@ void	init_vars(t_vars *vars)
 	vars->pos = 0;
 	vars->start = 0;
 	vars->hd_text_ready = 0;
+	vars->hd_src = NULL;
 }
 
 /*
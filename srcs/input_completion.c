@@ -33,6 +33,8 @@ char	*append_input(char *original, char *additional)
 
 /*
 Recursively reads additional input to complete unclosed quotes.
+- Input that ends before the quote is closed is a syntax error,
+  see quote_eof_error().
 Returns:
 - Completed input string.
 - NULL on error.
@@ -45,9 +47,13 @@ char	*fix_open_quotes(char *original_input, t_vars *vars)
 
 	if (!vars->quote_depth)
 		return (ft_strdup(original_input));
-	addon_input = quote_prompt(vars->quote_ctx[vars->quote_depth - 1].type);
+	addon_input = quote_prompt(vars->quote_ctx[vars->quote_depth - 1].type,
+			vars);
 	if (!addon_input)
+	{
+		quote_eof_error(vars->quote_ctx[vars->quote_depth - 1].type, vars);
 		return (NULL);
+	}
 	merged_input = append_input(original_input, addon_input);
 	ft_safefree((void **)&addon_input);
 	if (!merged_input)
@@ -68,7 +74,7 @@ Processes input with quotes that need completion.
 - Updates token list with completed input.
 Returns:
 Newly allocated complete command string.
-NULL on memory allocation failure.
+NULL at end of input or on memory allocation failure, cmd is freed.
 Works with process_command().
 
 Example: When user types "echo "hello
@@ -85,7 +91,10 @@ char	*handle_quote_completion(char *cmd, t_vars *vars)
 		return (cmd);
 	new_cmd = fix_open_quotes(cmd, vars);
 	if (!new_cmd)
+	{
+		ft_safefree((void **)&cmd);
 		return (NULL);
+	}
 	if (new_cmd != cmd)
 	{
 		ft_safefree((void **)&cmd);
@@ -143,7 +152,7 @@ int	handle_unfinished_pipes(char **processed_cmd, t_vars *vars)
 {
 	char	*addon_input;
 
-	addon_input = read_until_complete();
+	addon_input = read_until_complete(vars);
 	if (!addon_input)
 		return (-1);
 	if (append_to_cmdline(processed_cmd, addon_input) == -1)
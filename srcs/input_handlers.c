@@ -12,58 +12,6 @@
 
 #include "../includes/minishell.h"
 
-/*
-Allocates memory and reads content from an open file descriptor.
-- Allocates buffer of specified size plus null terminator
-- Reads file content into the buffer
-- Adds null terminator for string usage
-Returns:
-- Newly allocated string containing the file contents
-- NULL if allocation failed or reading failed
-*/
-char	*allocate_and_read(int fd, size_t size)
-{
-	char	*buffer;
-	ssize_t	bytes_read;
-
-	buffer = malloc(size + 1);
-	if (!buffer)
-		return (NULL);
-	bytes_read = read(fd, buffer, size);
-	if (bytes_read == -1)
-	{
-		ft_safefree((void **)&buffer);
-		return (NULL);
-	}
-	buffer[bytes_read] = '\0';
-	return (buffer);
-}
-
-/*
-Function reads an entire file into memory.
-Returns:
-- A newly allocated string containing the file contents,
-- NULL if an error occurred.
-*/
-char	*read_tmp_buf_file(const char *filename)
-{
-	int			fd;
-	char		*content;
-	struct stat	file_stats;
-
-	fd = open(filename, O_RDONLY);
-	if (fd == -1)
-		return (NULL);
-	if (fstat(fd, &file_stats) == -1)
-	{
-		close(fd);
-		return (NULL);
-	}
-	content = allocate_and_read(fd, file_stats.st_size);
-	close(fd);
-	return (content);
-}
-
 /*
 Processes user input and directs to appropriate command handler.
 - Detects and handles multiline input with heredocs
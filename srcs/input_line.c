@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_line.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/07/01 11:08:26 by bleow             #+#    #+#             */
+/*   Updated: 2025/07/01 15:52:13 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Chooses how the shell reads its input.
+- "-c cmd" runs the string and nothing else is set up, not even the
+  signal handlers.
+- A script argument is run instead of stdin, with $0 set to its path
+  and $1, $2... to the arguments after it.
+- A terminal on stdin gets the line editor: terminal settings, the
+  history directory and file, the indexed search key and the
+  history writer.
+- A file on stdin is read through vars->in_rd in blocks of
+  BUFFER_SIZE, without readline or any history.
+- A pipe on stdin is read a line at a time without read-ahead, see
+  read_line_peek().
+Works with init_shell().
+*/
+void	init_input(t_vars *vars, int argc, char **argv)
+{
+	if (open_cmd_string(argc, argv, vars))
+		return ;
+	load_signals();
+	if (argc > 1)
+	{
+		vars->pos_args = argv + 1;
+		vars->pos_count = argc - 2;
+		open_script(argv[1], vars);
+		return ;
+	}
+	vars->interactive = isatty(STDIN_FILENO);
+	if (!vars->interactive)
+	{
+		if (lseek(STDIN_FILENO, 0, SEEK_CUR) == -1)
+			init_pipe_input(vars);
+		else if (!ft_rd_init(&vars->in_rd, STDIN_FILENO, BUFFER_SIZE))
+			crit_error(vars);
+		return ;
+	}
+	setup_terminal_mode(vars);
+	hist_dir_open();
+	load_history(vars);
+	init_hist_search(vars);
+	hist_writer_start(vars);
+}
+
+/*
+Reads one line of input, for the main prompt and for every
+continuation (quotes, pipes, heredoc bodies).
+- Interactive shells show the prompt through readline().
+- Otherwise the line comes from the mapped script, the pipe reader
+  or the block reader without a prompt, so continuation
+  lines are taken from the same input.
+Returns:
+- The line without its newline, allocated.
+- NULL at end of input or on read error.
+*/
+char	*input_line(t_vars *vars, char *prompt)
+{
+	char	*line;
+
+	if (vars->interactive)
+		return (readline(prompt));
+	if (vars->script.map)
+		return (script_line(&vars->script));
+	if (vars->in_bytewise)
+		return (read_line_peek(vars));
+	if (ft_rd_line(&vars->in_rd, &line) < 0)
+		return (NULL);
+	return (line);
+}
+
+/*
+Hands input the block reader read ahead back to stdin.
+- Commands share the shell's stdin, so when it is a regular file the
+  offset is moved back to the start of the next unread line before
+  anything runs, as bash does.
+- A pipe cannot seek back, so it is read without any read-ahead.
+Works with process_command().
+*/
+void	input_sync(t_vars *vars)
+{
+	t_reader	*rd;
+
+	rd = &vars->in_rd;
+	if (vars->interactive || rd->start == rd->end)
+		return ;
+	if (lseek(rd->fd, -(off_t)(rd->end - rd->start), SEEK_CUR) == -1)
+		return ;
+	rd->start = 0;
+	rd->scan = 0;
+	rd->end = 0;
+	rd->eof = 0;
+}
+
+/*
+Tells whether the current command is the last one of the input.
+- Only known for scripts held in memory (mapped files and -c
+  strings), streamed input may still be waiting for more lines.
+- Trailing blank lines do not count as more input.
+Returns:
+- 1 if nothing but whitespace is left, 0 otherwise.
+Works with exec_external_cmd().
+*/
+int	input_at_end(t_vars *vars)
+{
+	size_t	pos;
+
+	if (!vars->script.map)
+		return (0);
+	pos = vars->script.pos;
+	while (pos < vars->script.len && ft_isspace(vars->script.map[pos]))
+		pos++;
+	return (pos >= vars->script.len);
+}
+
+/*
+Releases the non-interactive input.
+- Unmaps a mapped script file.
+- Closes a streamed script and frees the block reader.
+- Closes the peek pipe of a stdin pipe.
+Works with cleanup_vars().
+*/
+void	close_input(t_vars *vars)
+{
+	if (vars->script.mapped)
+		munmap(vars->script.map, vars->script.len);
+	vars->script.map = NULL;
+	if (vars->in_rd.buf && vars->in_rd.fd != STDIN_FILENO)
+		close(vars->in_rd.fd);
+	ft_rd_free(&vars->in_rd);
+	if (vars->in_bytewise && vars->in_peek[0] != -1)
+	{
+		close(vars->in_peek[0]);
+		close(vars->in_peek[1]);
+		vars->in_peek[0] = -1;
+		vars->in_peek[1] = -1;
+	}
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_peek.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/07/03 10:12:45 by bleow             #+#    #+#             */
+/*   Updated: 2025/07/03 16:48:09 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Sets up reading a stdin that cannot seek back.
+- Commands share stdin with the shell, so the shell must never take
+  more than the line it runs out of it.
+- A pipe or FIFO gets a private peek pipe for read_line_peek().
+- Anything else (sockets, devices) is read a byte at a time.
+Works with init_input().
+*/
+void	init_pipe_input(t_vars *vars)
+{
+	struct stat	st;
+
+	vars->in_bytewise = 1;
+	vars->in_peek[0] = -1;
+	vars->in_peek[1] = -1;
+	if (fstat(STDIN_FILENO, &st) == -1 || !S_ISFIFO(st.st_mode))
+		return ;
+	if (pipe2(vars->in_peek, O_CLOEXEC) == -1)
+	{
+		vars->in_peek[0] = -1;
+		vars->in_peek[1] = -1;
+	}
+}
+
+/*
+Copies the data waiting on stdin into the free space of line.
+- tee() duplicates it into the peek pipe without taking it off
+  stdin, and it is read back from there.
+- line->len is left alone, the caller decides how much to keep.
+Returns:
+- Number of bytes copied, 0 at end of input, -1 on error.
+Works with read_line_peek().
+*/
+ssize_t	peek_stdin(int *peek, t_strbuf *line)
+{
+	ssize_t	got;
+	ssize_t	bytes;
+	ssize_t	done;
+
+	if (!ft_sb_reserve(line, line->len + FT_RD_MIN_CAP))
+		return (-1);
+	got = -1;
+	while (got == -1)
+	{
+		got = tee(STDIN_FILENO, peek[1], line->cap - line->len - 1, 0);
+		if (got == -1 && errno != EINTR)
+			return (-1);
+	}
+	done = 0;
+	while (done < got)
+	{
+		bytes = read(peek[0], line->buf + line->len + done, got - done);
+		if (bytes == -1 && errno != EINTR)
+			return (-1);
+		if (bytes > 0)
+			done += bytes;
+	}
+	return (got);
+}
+
+/*
+Takes exactly n bytes off stdin into dst.
+- The bytes were peeked just before, so they are already waiting
+  and the reads return at once.
+Returns:
+- n on success, -1 on error.
+Works with read_line_peek().
+*/
+ssize_t	take_stdin(char *dst, ssize_t n)
+{
+	ssize_t	bytes;
+	ssize_t	done;
+
+	done = 0;
+	while (done < n)
+	{
+		bytes = read(STDIN_FILENO, dst + done, n - done);
+		if (bytes == 0 || (bytes == -1 && errno != EINTR))
+			return (-1);
+		if (bytes > 0)
+			done += bytes;
+	}
+	return (n);
+}
+
+/*
+Reads one line from the stdin pipe without reading past it.
+- Peeks at what is waiting, finds the newline in it and takes only
+  the bytes up to it off stdin, so a command run by this line still
+  gets the rest of the input.
+- Costs three syscalls per chunk of a line, where reading a byte at
+  a time costs one per byte.
+- Falls back to read_line_bytewise() when there is no peek pipe.
+Returns:
+- The line without its newline, allocated.
+- NULL at end of input or on read error.
+Works with input_line().
+*/
+char	*read_line_peek(t_vars *vars)
+{
+	t_strbuf	line;
+	ssize_t		got;
+	char		*nl;
+
+	if (vars->in_peek[0] == -1)
+		return (read_line_bytewise(STDIN_FILENO));
+	if (!ft_sb_init(&line, FT_RD_MIN_CAP))
+		return (NULL);
+	nl = NULL;
+	got = 1;
+	while (!nl && got > 0)
+	{
+		got = peek_stdin(vars->in_peek, &line);
+		nl = ft_memchr(line.buf + line.len, '\n', got * (got > 0));
+		if (nl)
+			got = nl - (line.buf + line.len) + 1;
+		if (got > 0)
+			got = take_stdin(line.buf + line.len, got);
+		line.len += got * (got > 0);
+	}
+	line.len -= (nl != NULL);
+	line.buf[line.len] = '\0';
+	if (got < 0 || (!nl && line.len == 0))
+		ft_sb_free(&line);
+	return (ft_sb_take(&line));
+}
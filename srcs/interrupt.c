@@ -19,7 +19,7 @@ Handles comprehensive cleanup when heredoc is interrupted by signal.
 - Cleans up partial input buffers
 - Resets pipe and redirection state
 - Preserves error code for signal propagation
-Called from process_hd_parent() when heredoc is interrupted.
+Called from interactive_hd_mode() when heredoc is interrupted.
 */
 void	hd_abort_cleanup(t_vars *vars)
 {
@@ -47,7 +47,7 @@ void	hd_abort_cleanup(t_vars *vars)
 Cleans up heredoc-specific state after interruption.
 - Resets heredoc readiness flag
 - Cleans up delimiter if set
-- Ensures temporary files are removed
+- Closes the heredoc store, discarding its content
 */
 void	hd_abort_state_reset(t_vars *vars)
 {
@@ -59,12 +59,7 @@ void	hd_abort_state_reset(t_vars *vars)
 		ft_safefree((void **)&vars->pipes->heredoc_delim);
 		vars->pipes->heredoc_delim = NULL;
 	}
-	unlink(TMP_BUF);
-	if (vars->pipes->hd_fd > 0)
-	{
-		close(vars->pipes->hd_fd);
-		vars->pipes->hd_fd = -1;
-	}
+	close_hd_store(vars);
 }
 
 /*
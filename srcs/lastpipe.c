@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lastpipe.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/21 10:21:56 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/21 12:41:08 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Checks whether the last stage of a pipeline runs in the shell itself.
+- Only with "shopt -s lastpipe" set.
+- The stage command, possibly under a redirection, must be a builtin.
+Returns:
+- 1 if the stage should run in the shell process.
+- 0 if it gets a child like every other stage.
+*/
+int	is_lastpipe_stage(t_node *stage, t_vars *vars)
+{
+	if (!vars->lastpipe || !stage)
+		return (0);
+	if (is_redirection(stage->type))
+		stage = stage->left;
+	if (!stage || stage->type != TYPE_CMD || !stage->args)
+		return (0);
+	return (is_builtin(stage->args[0]));
+}
+
+/*
+Runs the last pipeline stage in the shell process.
+- Saves STDIN and STDOUT close-on-exec and reads STDIN from the pipe.
+- Sets up the stage's redirections and runs the builtin, so that
+  changes it makes to the shell state are kept.
+- Restores the saved fds, which also closes the pipe so that earlier
+  stages get SIGPIPE instead of blocking on a full pipe.
+- The stage status is left in vars->error_code.
+Returns:
+- 0, the pid of a stage that has no child process.
+Works with fork_pipe_stage() and reap_pipe_stages().
+*/
+pid_t	run_lastpipe_stage(t_node *stage, int *in_fd, t_vars *vars)
+{
+	t_node	*curr;
+	int		status;
+
+	vars->pipes->saved_stdin = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, 0);
+	vars->pipes->saved_stdout = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 0);
+	status = 1;
+	if (*in_fd != -1 && dup2(*in_fd, STDIN_FILENO) != -1)
+		status = setup_pipe_cmd(stage, vars, &curr);
+	if (*in_fd != -1)
+		close(*in_fd);
+	*in_fd = -1;
+	if (status == 0)
+		status = execute_cmd(curr, get_envp(vars), vars);
+	reset_redirect_fds(vars);
+	vars->error_code = status;
+	return (0);
+}
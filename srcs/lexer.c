@@ -14,7 +14,7 @@
 
 /* 
 Master function to get token type at current position
-Checks double tokens first, then single tokens
+Checks triple tokens first, then double and single tokens
 Returns token type and updates position via moves parameter
 */
 t_tokentype	get_token_at(char *input, int pos, int *moves)
@@ -23,6 +23,9 @@ t_tokentype	get_token_at(char *input, int pos, int *moves)
 
 	token_type = 0;
 	*moves = 0;
+	token_type = is_triple_token(input, pos, moves);
+	if (token_type != 0)
+		return (token_type);
 	token_type = is_double_token(input, pos, moves);
 	if (token_type != 0)
 		return (token_type);
@@ -133,7 +136,7 @@ char	*get_quoted_str(char *input, t_vars *vars, int *quote_type)
 	{
 		return (handle_quote_completion(input, vars));
 	}
-	content = ft_substr(input, vars->pos, end - vars->pos);
+	content = ft_strndup(input + vars->pos, end - vars->pos);
 	vars->pos = end + 1;
 	return (content);
 }
@@ -22,7 +22,7 @@ void	add_null_token_stop(t_vars *vars)
 
 	if (!vars || !vars->head)
 		return ;
-	null_node = initnode(TYPE_NULL, "");
+	null_node = initnode(TYPE_NULL, "", vars);
 	if (!null_node)
 		return ;
 	if (vars->current)
@@ -21,6 +21,7 @@ For input "$HOME/dir", it sets:
 - token = "$HOME"
 - var_name = "HOME"
 - vars->pos points to the '/' after "HOME"
+Positional parameters ($1) and $# take a single character.
 Returns:
 - 1 on success.
 - 0 on failure.
@@ -33,13 +34,16 @@ int	get_expn_name(char *input, t_vars *vars, char **token, char **var_name)
 
 	start = vars->pos + 1;
 	vars->pos++;
-	while (input[vars->pos] && (ft_isalnum(input[vars->pos])
-			||input[vars->pos] == '_'))
+	if (is_param_char(input[vars->pos]))
 		vars->pos++;
-	tokstr = ft_substr(input, vars->start, vars->pos - vars->start);
+	else
+		while (input[vars->pos] && (ft_isalnum(input[vars->pos])
+				||input[vars->pos] == '_'))
+			vars->pos++;
+	tokstr = ft_strndup(input + vars->start, vars->pos - vars->start);
 	if (!tokstr)
 		return (0);
-	var_str = ft_substr(input, start, vars->pos - start);
+	var_str = ft_strndup(input + start, vars->pos - start);
 	if (!var_str)
 	{
 		ft_safefree((void **)&tokstr);
@@ -65,7 +69,7 @@ int	get_var_token(char *input, t_vars *vars, char **token, char **var_name)
 {
 	if (input[vars->pos] == '$' && input[vars->pos + 1] == '?')
 	{
-		*token = ft_substr(input, vars->start, 2);
+		*token = ft_strndup(input + vars->start, 2);
 		if (!*token)
 			return (0);
 		*var_name = ft_strdup("?");
@@ -125,6 +129,8 @@ int	sub_make_exp_token(char *input, t_vars *vars, char *expanded_val
 Main processing function for expanded token.
 Handles adjacency rules.
 Handles joining, creating new tokens, and processing right adjacency
+A standalone $@ or $* becomes one token per argument, see
+make_pos_tokens().
 Returns:
 - 1 on success
 - 0 on failure
@@ -134,15 +140,18 @@ int	make_exp_token(char *input, t_vars *vars)
 	char	*token;
 	char	*expanded_val;
 	char	*var_name;
-	int		result;
 
 	token = NULL;
-	expanded_val = NULL;
 	var_name = NULL;
 	vars->start = vars->pos;
 	check_token_adj(input, vars);
 	if (!get_var_token(input, vars, &token, &var_name))
 		return (0);
+	if (is_pos_words(input, var_name, vars))
+	{
+		ft_safefree((void **)&var_name);
+		return (make_pos_tokens(vars, token));
+	}
 	expanded_val = expand_variable(NULL, NULL, var_name, vars);
 	ft_safefree((void **)&var_name);
 	if (!expanded_val)
@@ -150,8 +159,7 @@ int	make_exp_token(char *input, t_vars *vars)
 		ft_safefree((void **)&token);
 		return (0);
 	}
-	result = sub_make_exp_token(input, vars, expanded_val, token);
-	return (result);
+	return (sub_make_exp_token(input, vars, expanded_val, token));
 }
 
 /*
@@ -168,7 +176,7 @@ int	new_exp_token(t_vars *vars, char *expanded_val, char *token)
 	{
 		token_type = TYPE_CMD;
 	}
-	exp_node = initnode(token_type, expanded_val);
+	exp_node = initnode(token_type, expanded_val, vars);
 	if (!exp_node)
 		return (0);
 	build_token_linklist(vars, exp_node);
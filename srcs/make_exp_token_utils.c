@@ -86,26 +86,26 @@ void	process_right_adj(char *input, t_vars *vars)
 /*
 Reallocates and extends a single quote type array (int *).
 Modifies *quo_arr_ptr directly.
+The array lives in the arena and grows with arena_realloc(), in place
+when it was the last block handed out.
 Returns:
 - 0 on success.
 - 1 on error.
 */
-int	realloc_quo_arr(int **quo_arr_ptr, size_t new_char_len)
+int	realloc_quo_arr(int **quo_arr_ptr, size_t new_char_len,
+			t_arena *arena)
 {
-	int		*old_int_arr;
 	int		*new_int_arr;
 	size_t	old_len;
 	size_t	total_len;
 	size_t	i;
 
-	old_int_arr = *quo_arr_ptr;
-	old_len = ft_intarrlen(old_int_arr);
+	old_len = ft_intarrlen(*quo_arr_ptr);
 	total_len = old_len + new_char_len;
-	new_int_arr = malloc(sizeof(int) * (total_len + 1));
+	new_int_arr = arena_realloc(arena, *quo_arr_ptr,
+			sizeof(int) * (old_len + 1), sizeof(int) * (total_len + 1));
 	if (!new_int_arr)
 		return (0);
-	if (old_len > 0)
-		ft_memcpy(new_int_arr, old_int_arr, sizeof(int) * old_len);
 	i = 0;
 	while (i < new_char_len)
 	{
@@ -113,7 +113,6 @@ int	realloc_quo_arr(int **quo_arr_ptr, size_t new_char_len)
 		i++;
 	}
 	new_int_arr[total_len] = -1;
-	ft_safefree((void **)&old_int_arr);
 	*quo_arr_ptr = new_int_arr;
 	return (1);
 }
@@ -137,5 +136,5 @@ int	update_quote_types(t_vars *vars, int arg_idx, char *appended_text)
 	if (appended_len == 0)
 		return (1);
 	return (realloc_quo_arr(&(vars->current->arg_quote_type[arg_idx]),
-			appended_len));
+			appended_len, &vars->arena));
 }
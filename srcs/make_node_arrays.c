@@ -14,47 +14,44 @@
 
 /* 
 Sets up the arguments array for a node.
+- The array comes from the arena, the argument string from the heap.
 Returns:
 - The allocated args array.
 - NULL if error.
 */
-char	**setup_args(char *token)
+char	**setup_args(char *token, t_arena *arena)
 {
 	char	**args;
 
-	args = malloc(sizeof(char *) * 2);
+	args = arena_alloc(arena, sizeof(char *) * 2);
 	if (!args)
 		return (NULL);
 	args[0] = ft_strdup(token);
 	if (!args[0])
-	{
-		ft_safefree((void **)&args);
 		return (NULL);
-	}
 	args[1] = NULL;
 	return (args);
 }
 
 /*
 Sets up the quote tracking arrays for an argument.
+- Both the array and the quote types of the argument come from
+  the arena.
 Returns:
 - The allocated quote types array.
 - NULL if error.
 */
-int	**setup_quotes(int len)
+int	**setup_quotes(int len, t_arena *arena)
 {
 	int	**quote_types;
 	int	i;
 
-	quote_types = malloc(sizeof(int *) * 2);
+	quote_types = arena_alloc(arena, sizeof(int *) * 2);
 	if (!quote_types)
 		return (NULL);
-	quote_types[0] = malloc(sizeof(int) * (len + 1));
+	quote_types[0] = arena_alloc(arena, sizeof(int) * (len + 1));
 	if (!quote_types[0])
-	{
-		ft_safefree((void **)&quote_types);
 		return (NULL);
-	}
 	i = 0;
 	while (i < len)
 	{
@@ -70,14 +67,27 @@ int	**setup_quotes(int len)
 Creates an argument array for a node with a single argument.
 Allocates memory for the array and initializes it with the given token.
 Also allocates character-level quote type arrays for each argument.
+The arrays come from node->arena, only the argument string is freed
+on its own, by free_token_node().
+Leaves node->args NULL if either array cannot be allocated.
 */
 void	make_node_arrays(t_node *node, char *token)
 {
 	int	len;
 
-	node->args = setup_args(token);
+	node->arg_count = 0;
+	node->arg_cap = 0;
+	node->args = setup_args(token, node->arena);
 	if (!node->args)
 		return ;
 	len = ft_strlen(token);
-	node->arg_quote_type = setup_quotes(len);
+	node->arg_quote_type = setup_quotes(len, node->arena);
+	if (!node->arg_quote_type)
+	{
+		ft_safefree((void **)&node->args[0]);
+		node->args = NULL;
+		return ;
+	}
+	node->arg_count = 1;
+	node->arg_cap = 2;
 }
@@ -55,7 +55,7 @@ int	make_quoted_cmd(char *content, char *input, t_vars *vars)
 {
 	t_node	*cmd_node;
 
-	cmd_node = initnode(TYPE_CMD, content);
+	cmd_node = initnode(TYPE_CMD, content, vars);
 	if (!cmd_node)
 	{
 		return (token_cleanup_error(content, vars));
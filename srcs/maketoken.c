@@ -30,7 +30,7 @@ void	maketoken(char *token, t_tokentype type, t_vars *vars)
 
 	if (!token || !vars)
 		return ;
-	node = initnode(type, token);
+	node = initnode(type, token, vars);
 	if (!node)
 		return ;
 	if (type == TYPE_PIPE)
@@ -84,7 +84,8 @@ int	build_token_linklist(t_vars *vars, t_node *node)
 
 /*
 Merges an argument node into a command node.
-- Appends argument text to command's argument list
+- Moves the argument text and its quote types to the command's
+  argument list without copying them
 - Updates linked list connections after merging
 - Frees the now-redundant argument node
 Returns:
@@ -97,7 +98,9 @@ int	merge_arg_with_cmd(t_vars *vars, t_node *arg_node)
 
 	cmd_node = vars->current;
 	next_node = arg_node->next;
-	append_arg(cmd_node, arg_node->args[0], 0);
+	append_arg_owned(cmd_node, arg_node->args[0], arg_node->arg_quote_type[0]);
+	arg_node->args[0] = NULL;
+	arg_node->arg_quote_type[0] = NULL;
 	if (next_node)
 	{
 		cmd_node->next = next_node;
@@ -114,7 +117,8 @@ int	merge_arg_with_cmd(t_vars *vars, t_node *arg_node)
 
 /*
 Checks if a node is orphaned (not properly linked in the token list)
-and frees it if necessary to prevent memory leaks.
+and frees its arrays if necessary to prevent memory leaks.
+The node itself stays in the arena until the next reset.
 This function is called when a node is created and added to the token list.
 */
 void	free_if_orphan_node(t_node *node, t_vars *vars)
@@ -135,5 +139,5 @@ void	free_if_orphan_node(t_node *node, t_vars *vars)
 		check = check->next;
 	}
 	if (!found_in_list)
-		ft_safefree((void **)&node);
+		free_token_node(node);
 }
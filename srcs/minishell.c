@@ -17,6 +17,7 @@ Reads input line from the user with prompt display.
 - Displays the shell prompt and awaits user input.
 - Handles Ctrl+D (EOF) by calling builtin_exit.
 - Adds non-empty lines to command history.
+- Reads without prompt or history when stdin is not a terminal.
 Returns:
 - User input as an allocated string.
 - Never returns on EOF (exits program).
@@ -38,11 +39,11 @@ Example: When user types "ls -la"
 // 		add_history(line);
 // 	return (line);
 // }
-char	*reader(void)
+char	*reader(t_vars *vars)
 {
 	char	*line;
 
-	line = readline(PROMPT);
+	line = input_line(vars, PROMPT);
 	if (g_signal_received == 130)
 	{
 		g_signal_received = 0;
@@ -55,7 +56,7 @@ char	*reader(void)
 	}
 	if (!line)
 		return (NULL);
-	if (*line)
+	if (*line && vars->interactive)
 		add_history(line);
 	return (line);
 }
@@ -99,7 +100,9 @@ Works with handle_input().
 Example: When user types a complex command
 - Processes tokens and handles unclosed quotes.
 - Validates and completes pipe syntax if needed.
-- Builds and executes command if valid.
+- Reads every heredoc body before anything runs.
+- Builds and executes command if valid, after handing unread
+  script input back to stdin.
 */
 void	process_command(char *command, t_vars *vars)
 {
@@ -116,11 +119,12 @@ void	process_command(char *command, t_vars *vars)
 	}
 	if (!handle_pipe_syntax(vars))
 		return ;
-	if (!validate_redir_targets(vars))
+	if (!validate_redir_targets(vars) || !gather_heredocs(vars))
 		return ;
 	vars->astroot = ast_builder(vars);
+	input_sync(vars);
 	if (vars->astroot)
-		execute_cmd(vars->astroot, vars->env, vars);
+		execute_cmd(vars->astroot, get_envp(vars), vars);
 	if (vars->partial_input)
 	{
 		ft_safefree((void **)&vars->partial_input);
@@ -128,8 +132,33 @@ void	process_command(char *command, t_vars *vars)
 	}
 }
 
+/*
+Runs one line of user input and records it in the history file.
+- Only interactive shells keep a history.
+- The entry gets the start time, duration and exit status of the
+  command, so it is written once the command has finished.
+- Keeps the history search index up to date once it is loaded.
+- Frees the input and resets the shell for the next line.
+Works with main().
+*/
+void	run_input(char *input, t_vars *vars)
+{
+	time_t	start;
+
+	start = time(NULL);
+	handle_input(input, vars);
+	if (vars->interactive)
+		append_history_entry(input, start, vars);
+	if (vars->hist_idx.loaded)
+		hist_index_add(&vars->hist_idx, input);
+	ft_safefree((void **)&input);
+	reset_shell(vars);
+}
+
 /*
 Main shell loop that processes user commands and manages execution flow.
+- "minishell script [args...]" runs the script instead of stdin,
+  "minishell -c cmd" runs cmd, both exit with the last status.
 - Reads input through reader() function.
 - Handles Ctrl+D and empty input cases.
 - Processes commands through tokenizing and execution.
@@ -142,15 +171,13 @@ int	main(int argc, char **argv, char **envp)
 	char	*input;
 	char	*exit_args[2];
 
-	(void)argc;
-	(void)argv;
 	exit_args[0] = "exit";
 	exit_args[1] = NULL;
 	ft_memset(&vars, 0, sizeof(t_vars));
-	init_shell(&vars, envp);
+	init_shell(&vars, argc, argv, envp);
 	while (1)
 	{
-		input = reader();
+		input = reader(&vars);
 		if (input == NULL)
 			builtin_exit(exit_args, &vars);
 		if (input[0] == '\0')
@@ -158,9 +185,7 @@ int	main(int argc, char **argv, char **envp)
 			ft_safefree((void **)&input);
 			continue ;
 		}
-		handle_input(input, &vars);
-		ft_safefree((void **)&input);
-		reset_shell(&vars);
+		run_input(input, &vars);
 	}
 	return (0);
 }
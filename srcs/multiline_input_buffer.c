@@ -12,64 +12,39 @@
 
 #include "../includes/minishell.h"
 
-/*
-Extracts the next line from a content buffer.
-Returns:
-- The extracted line.
-- NULL on error.
-*/
-char	*extract_next_line(char **current_pos_ptr, t_vars *vars)
-{
-	char	*next_newline;
-	char	*line;
-	char	*current_pos;
-
-	current_pos = *current_pos_ptr;
-	next_newline = ft_strchr(current_pos, '\n');
-	if (next_newline)
-	{
-		line = ft_substr(current_pos, 0, next_newline - current_pos);
-		*current_pos_ptr = next_newline + 1;
-	}
-	else
-	{
-		line = ft_strdup(current_pos);
-		*current_pos_ptr = NULL;
-	}
-	if (!line)
-	{
-		vars->error_code = ERR_DEFAULT;
-		return (NULL);
-	}
-	return (line);
-}
-
 /*
 Processes heredoc content from the input buffer.
-Reads lines from 'content',checks against delimiter, writes to fd.
+Reads lines from *content, checks against delimiter, writes to fd.
+- Each line is terminated in place for the duration of the check,
+  so no copy of the line is made.
+- Advances *content past the consumed lines, so the next heredoc
+  of the command line continues from there.
 Returns:
 - 1 if delimiter found.
 - 0 if end of buffer without delimiter.
 - -1 on error.
 */
-int	proc_hd_buffer(int write_fd, char *content, t_vars *vars)
+int	proc_hd_buffer(int write_fd, char **content, t_vars *vars)
 {
-	char	*current_pos;
 	char	*line;
+	char	*newline;
 	int		found;
-	int		result;
 
-	current_pos = content;
 	found = 0;
-	while (current_pos && *current_pos && !found)
+	while (*content && **content && !found)
 	{
-		line = extract_next_line(&current_pos, vars);
-		if (!line)
-			return (-1);
-		result = proc_hd_line(write_fd, line, vars);
-		if (result == 1)
-			found = 1;
-		else if (result == -1)
+		line = *content;
+		newline = ft_strchr(line, '\n');
+		*content = NULL;
+		if (newline)
+		{
+			*newline = '\0';
+			*content = newline + 1;
+		}
+		found = proc_hd_line(write_fd, line, vars);
+		if (newline)
+			*newline = '\n';
+		if (found == -1)
 			return (-1);
 	}
 	return (found);
@@ -77,70 +52,27 @@ int	proc_hd_buffer(int write_fd, char *content, t_vars *vars)
 
 /*
 Handles the case where the first line is not a heredoc command.
-Writes the entire input to TMP_BUF and calls tmp_buf_reader().
+Splits the input into commands in memory with tmp_buf_reader().
 Returns:
-- 1 on success.
-- 0 on failure (e.g., file I/O error).
- */
+- 1 (errors are reported through vars->error_code).
+*/
 int	process_standard(char *input, t_vars *vars)
 {
-	int		fd;
-	ssize_t	write_len;
-	size_t	input_len;
-
-	fd = open(TMP_BUF, O_WRONLY | O_CREAT | O_TRUNC, 0600);
-	if (fd == -1)
-	{
-		vars->error_code = ERR_DEFAULT;
-		return (0);
-	}
-	input_len = ft_strlen(input);
-	write_len = write(fd, input, input_len);
-	if (write_len == -1 || (size_t)write_len != input_len)
-	{
-		close(fd);
-		unlink(TMP_BUF);
-		return (0);
-	}
-	close(fd);
-	tmp_buf_reader(vars);
+	tmp_buf_reader(input, vars);
 	return (1);
 }
 
-/*
-Opens the temporary file for writing heredoc content.
-Returns:
-- File descriptor on success.
-- -1 on failure (prints error).
- */
-int	open_hd_tmp_buf(t_vars *vars)
-{
-	int	write_fd;
-
-	write_fd = open(TMP_BUF, O_WRONLY | O_CREAT | O_TRUNC, 0600);
-	if (write_fd == -1)
-	{
-		vars->error_code = ERR_DEFAULT;
-		return (-1);
-	}
-	return (write_fd);
-}
-
 /*
 Calls the interactive heredoc reader if delimiter wasn't in buffer.
+The reader keeps appending to the heredoc store the buffered
+lines were written to.
 Returns: 
 - 0 on success (or if no interactive needed).
-- -1 on interactive error.
+- -1 on interactive error or interruption.
 */
-int	handle_interactive_hd(int write_fd, int found_in_buf, t_vars *vars)
+int	handle_interactive_hd(int found_in_buf, t_vars *vars)
 {
-	int	status;
-
-	status = 0;
-	if (!found_in_buf)
-	{
-		close(write_fd);
-		status = interactive_hd_mode(vars, g_signal_received, 0);
-	}
-	return (status);
+	if (!found_in_buf && !interactive_hd_mode(vars))
+		return (-1);
+	return (0);
 }
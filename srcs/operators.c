@@ -28,6 +28,8 @@ int	is_operator_token(t_tokentype type)
 		return (1);
 	if (type == TYPE_HEREDOC)
 		return (1);
+	if (type == TYPE_HERESTRING)
+		return (1);
 	return (0);
 }
 
@@ -49,7 +51,7 @@ void	handle_string(char *input, t_vars *vars)
 	string_token_position = 0;
 	if (vars->pos > vars->start)
 	{
-		token = ft_substr(input, vars->start, vars->pos - vars->start);
+		token = ft_strndup(input + vars->start, vars->pos - vars->start);
 		if (!token)
 			return ;
 		token_type = get_token_at(token, 0, &moves);
@@ -76,7 +78,7 @@ int	handle_pipe_operator(char *input, t_vars *vars)
 {
 	char	*token;
 
-	token = ft_substr(input, vars->pos, 1);
+	token = ft_strndup(input + vars->pos, 1);
 	if (!token)
 		return (vars->pos);
 	maketoken(token, vars->curr_type, vars);
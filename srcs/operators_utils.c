@@ -67,3 +67,21 @@ int	is_double_token(char *input, int pos, int *moves)
 	}
 	return (token_type);
 }
+
+/* 
+Checks if characters at position form a triple-character token
+Returns the token type enum value, 0 if not a triple token
+Handles: <<<
+*/
+int	is_triple_token(char *input, int pos, int *moves)
+{
+	*moves = 0;
+	if (!input || !input[pos] || !input[pos + 1])
+		return (0);
+	if (input[pos] == '<' && input[pos + 1] == '<' && input[pos + 2] == '<')
+	{
+		*moves = 3;
+		return (TYPE_HERESTRING);
+	}
+	return (0);
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   outbuf.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/30 10:21:52 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/30 16:47:05 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Writes a list of buffers to fd in full.
+- Retries after signals and continues after short writes.
+- The iovec array is consumed as bytes go out.
+Returns:
+- 0 once every byte is written.
+- (-1) on write failure, errno is set.
+Works with out_flush(), out_write() and flush_hd_buf().
+*/
+int	write_iov(int fd, struct iovec *iov, int cnt)
+{
+	ssize_t	n;
+
+	while (cnt > 0)
+	{
+		n = writev(fd, iov, cnt);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n == -1)
+			return (-1);
+		while (cnt > 0 && (size_t)n >= iov->iov_len)
+		{
+			n -= iov->iov_len;
+			iov++;
+			cnt--;
+		}
+		if (cnt > 0)
+		{
+			iov->iov_base = (char *)iov->iov_base + n;
+			iov->iov_len -= n;
+		}
+	}
+	return (0);
+}
+
+/*
+Writes out everything buffered so far.
+- Called at the end of every builtin, so the buffer is empty
+  whenever the shell forks, execs or exits.
+Returns:
+- 0 on success.
+- (-1) if this or an earlier write failed.
+Works with out_flush_builtin(), fork_stage_child() and cleanup_exit().
+*/
+int	out_flush(t_outbuf *out)
+{
+	struct iovec	iov;
+
+	if (out->len && !out->err)
+	{
+		iov.iov_base = out->buf;
+		iov.iov_len = out->len;
+		if (write_iov(STDOUT_FILENO, &iov, 1) == -1)
+			out->err = errno;
+	}
+	out->len = 0;
+	if (out->err)
+		return (-1);
+	return (0);
+}
+
+/*
+Appends bytes to the output buffer.
+- When they do not fit, the buffer and the new bytes go out together
+  in one writev(), so large arguments are never copied.
+- Output is dropped once a write failed, until the next flush.
+Returns:
+- 0 on success.
+- (-1) on write failure.
+*/
+int	out_write(t_outbuf *out, const char *data, size_t len)
+{
+	struct iovec	iov[2];
+
+	if (out->err)
+		return (-1);
+	if (len <= OUT_BUF_SZ - out->len)
+	{
+		ft_memcpy(out->buf + out->len, data, len);
+		out->len += len;
+		return (0);
+	}
+	iov[0].iov_base = out->buf;
+	iov[0].iov_len = out->len;
+	iov[1].iov_base = (void *)data;
+	iov[1].iov_len = len;
+	out->len = 0;
+	if (write_iov(STDOUT_FILENO, iov, 2) == -1)
+	{
+		out->err = errno;
+		return (-1);
+	}
+	return (0);
+}
+
+/*
+Appends a string to the output buffer.
+Returns:
+- 0 on success.
+- (-1) on write failure.
+*/
+int	out_puts(t_outbuf *out, const char *str)
+{
+	return (out_write(out, str, ft_strlen(str)));
+}
+
+/*
+Flushes the output of a builtin once it is done.
+- Also flushes stdio, for the builtins that still use printf().
+- Reports a failed write as "bleshell: <cmd>: write error: <reason>".
+Returns:
+- 0 on success.
+- 1 if any write of the builtin failed.
+Works with execute_builtin().
+*/
+int	out_flush_builtin(char *cmd, t_outbuf *out)
+{
+	int	err;
+
+	out_flush(out);
+	fflush(stdout);
+	err = out->err;
+	out->err = 0;
+	if (!err)
+		return (0);
+	ft_putstr_fd("bleshell: ", STDERR_FILENO);
+	ft_putstr_fd(cmd, STDERR_FILENO);
+	ft_putstr_fd(": write error: ", STDERR_FILENO);
+	ft_putendl_fd(strerror(err), STDERR_FILENO);
+	return (1);
+}
@@ -41,45 +41,69 @@ char	**get_path_env(char **envp)
 }
 
 /*
-Searches for a command in PATH environment directories.
-- Gets list of directories from PATH environment variable.
-- Tries each directory to find the command.
-- Reports detailed search progress for ddebugging.
+Tries each PATH directory in turn to find the command.
+- Takes ownership of the paths array and frees it.
 Returns:
--Full path to command if found, NULL otherwise.
-Works with get_cmd_path() for command resolution.
+- Full path to command if found, NULL otherwise.
+Works with search_in_env().
 
 Example: For command "grep" with PATH=/usr/bin:/bin
 - Searches in /usr/bin and /bin
 - Returns "/usr/bin/grep" if found there
 - Returns NULL if not found in any directory
 */
-char	*search_in_env(char *cmd, char **envp, t_vars *vars)
+char	*search_path_dirs(char *cmd, char **paths)
 {
-	char	**paths;
 	char	*path;
 	int		i;
 
-	paths = get_path_env(envp);
-	if (!paths)
-	{
-		ft_putendl_fd("No PATH found in environment", 2);
-		return (NULL);
-	}
+	path = NULL;
 	i = 0;
-	while (paths[i])
+	while (paths[i] && !path)
 	{
 		path = try_path(paths[i], cmd);
-		if (path)
-		{
-			ft_free_2d(paths, ft_arrlen(paths));
-			return (path);
-		}
 		i++;
 	}
-	shell_error(cmd, ERR_CMD_NOT_FOUND, vars);
 	ft_free_2d(paths, ft_arrlen(paths));
-	return (NULL);
+	return (path);
+}
+
+/*
+Searches for a command in PATH environment directories.
+- Answers from the command hash table when the command was seen before,
+  including commands already known to be missing.
+- Otherwise walks the PATH directories and hashes the result.
+Returns:
+-Full path to command if found, NULL otherwise.
+Works with get_cmd_path() for command resolution.
+*/
+char	*search_in_env(char *cmd, char **envp, t_vars *vars)
+{
+	t_cmdhash	*entry;
+	char		**paths;
+	char		*path;
+
+	entry = cmd_hash_find(vars, cmd);
+	if (!entry)
+	{
+		paths = get_path_env(envp);
+		if (!paths)
+		{
+			ft_putendl_fd("No PATH found in environment", 2);
+			return (NULL);
+		}
+		path = search_path_dirs(cmd, paths);
+		entry = cmd_hash_store(vars, cmd, path);
+	}
+	else if (entry->path)
+		path = ft_strdup(entry->path);
+	else
+		path = NULL;
+	if (entry)
+		entry->hits++;
+	if (!path)
+		shell_error(cmd, ERR_CMD_NOT_FOUND, vars);
+	return (path);
 }
 
 /*
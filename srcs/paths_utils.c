@@ -14,13 +14,12 @@
 
 /*
 Checks if a command exists in a specific directory.
-- Joins directory path with command name.
+- Builds "dir/cmd" in a stack buffer instead of joining strings.
 - Uses access() to verify file existence.
-- Frees intermediate memory allocations.
 Returns:
 - Full path to executable if found.
 - NULL if not found.
-Works with search_in_env() during command search.
+Works with search_path_dirs() during command search.
 
 Example: try_path("/usr/bin", "ls")
 - Checks if "/usr/bin/ls" exists and is accessible
@@ -29,15 +28,18 @@ Example: try_path("/usr/bin", "ls")
 */
 char	*try_path(char *path, char *cmd)
 {
-	char	*part_path;
-	char	*full_path;
+	char	full_path[PATH_MAX];
+	size_t	len;
 
-	part_path = ft_strjoin(path, "/");
-	full_path = ft_strjoin(part_path, cmd);
-	ft_safefree((void **)&part_path);
+	len = ft_strlcpy(full_path, path, PATH_MAX);
+	if (len + 1 >= PATH_MAX)
+		return (NULL);
+	full_path[len] = '/';
+	full_path[len + 1] = '\0';
+	if (ft_strlcat(full_path, cmd, PATH_MAX) >= PATH_MAX)
+		return (NULL);
 	if (access(full_path, F_OK) == 0)
-		return (full_path);
-	ft_safefree((void **)&full_path);
+		return (ft_strdup(full_path));
 	return (NULL);
 }
 
@@ -22,12 +22,12 @@ Returns:
 - A valid, non-empty string that the caller must free
 - NULL on critical error (like EOF)
 */
-char	*read_until_complete(void)
+char	*read_until_complete(t_vars *vars)
 {
 	char	*input;
 	char	*trimmed;
 
-	input = readline("> ");
+	input = input_line(vars, "> ");
 	if (!input)
 		return (NULL);
 	trimmed = ft_strtrim(input, " \t\n");
@@ -35,7 +35,7 @@ char	*read_until_complete(void)
 	if (!trimmed || trimmed[0] == '\0')
 	{
 		ft_safefree((void **)&trimmed);
-		return (read_until_complete());
+		return (read_until_complete(vars));
 	}
 	return (trimmed);
 }
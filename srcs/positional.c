@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   positional.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/22 11:15:03 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/22 11:58:21 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Checks whether a character names a one-character parameter.
+- Digits are positional parameters, '#' their count and '@' and '*'
+  all of them.
+Returns 1 if it does, 0 otherwise.
+Works with get_var_name(), get_expn_name() and handle_special_var().
+*/
+int	is_param_char(int c)
+{
+	return (ft_isdigit(c) || c == '#' || c == '@' || c == '*');
+}
+
+/*
+Returns the value of a positional parameter ($0 to $9), of $# or of
+$@ and $*.
+- $0 is the script path, or "bleshell" without a script.
+- $1 to $9 are the arguments given after the script.
+- $@ and $* are $1 to the last argument, joined by single spaces.
+Returns:
+- Newly allocated string with the value, empty if not set.
+Example: For "minishell deploy.sh prod eu":
+$0 -> "deploy.sh", $1 -> "prod", $3 -> "", $# -> "2", $@ -> "prod eu"
+*/
+char	*positional_var(const char *name, t_vars *vars)
+{
+	int	n;
+
+	if (name[0] == '#')
+		return (ft_itoa(vars->pos_count));
+	if (name[0] == '@' || name[0] == '*')
+		return (positional_all(vars));
+	n = name[0] - '0';
+	if (n == 0 && !vars->pos_args)
+		return (ft_strdup("bleshell"));
+	if (n > vars->pos_count)
+		return (ft_strdup(""));
+	return (ft_strdup(vars->pos_args[n]));
+}
+
+/*
+Joins every positional parameter from $1 on with single spaces.
+Returns:
+- Newly allocated string, empty without arguments.
+- NULL on allocation failure.
+Works with positional_var().
+*/
+char	*positional_all(t_vars *vars)
+{
+	t_strbuf	all;
+	int			i;
+
+	if (!ft_sb_init(&all, 64))
+		return (NULL);
+	i = 1;
+	while (i <= vars->pos_count)
+	{
+		if ((i > 1 && !ft_sb_append(&all, " ", 1))
+			|| !ft_sb_append(&all, vars->pos_args[i],
+				ft_strlen(vars->pos_args[i])))
+		{
+			ft_sb_free(&all);
+			return (NULL);
+		}
+		i++;
+	}
+	return (ft_sb_take(&all));
+}
+
+/*
+Tells whether a $@ or $* expands to one word per argument.
+- Only a $@ or $* that is a word on its own, with nothing joined to
+  it on either side. input is read from vars->pos, just past it.
+Returns 1 if it does, 0 otherwise.
+Works with make_exp_token().
+*/
+int	is_pos_words(char *input, char *var_name, t_vars *vars)
+{
+	char	next;
+
+	if (var_name[0] != '@' && var_name[0] != '*')
+		return (0);
+	next = input[vars->pos];
+	return (!vars->adj_state[0]
+		&& (!next || ft_isspace(next) || ft_is_operator(next)));
+}
+
+/*
+Expands a $@, "$@" or $* standing on its own into one word per
+positional parameter, as they are in bash.
+- Each argument becomes its own token, so "cmd "$@"" passes them on
+  one by one. Without arguments no word is left at all.
+- Arguments are not split further, there is no IFS word splitting.
+- A $@ or "$@" joined to other text expands like "$*".
+Returns:
+- 1 on success.
+- 0 on allocation failure.
+Works with make_exp_token().
+*/
+int	make_pos_tokens(t_vars *vars, char *token)
+{
+	char	*word;
+	int		i;
+
+	ft_safefree((void **)&token);
+	i = 1;
+	while (i <= vars->pos_count)
+	{
+		word = ft_strdup(vars->pos_args[i++]);
+		if (!word || !new_exp_token(vars, word, NULL))
+		{
+			ft_safefree((void **)&word);
+			return (0);
+		}
+	}
+	process_adj(NULL, vars);
+	return (1);
+}
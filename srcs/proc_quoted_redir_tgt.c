@@ -171,7 +171,7 @@ int	link_new_file_node_to_redir(t_node *redir_node,
 		vars->error_code = ERR_SYNTAX;
 		return (0);
 	}
-	file_node = initnode(TYPE_ARGS, content);
+	file_node = initnode(TYPE_ARGS, content, vars);
 	if (!file_node)
 	{
 		ft_safefree((void **)&content);
@@ -15,9 +15,9 @@
 /*
 Processes multiline input strings.
 - If no newline is found, treats as single-line input.
-- If the first line contains a heredoc (<<), processes heredoc content
-  into TMP_BUF and sets hd_text_ready=1 before executing the command.
-- Otherwise, writes the full input to TMP_BUF and calls tmp_buf_reader().
+- If the first line contains a heredoc (<<), executes it with the
+  following lines as the source of its heredoc bodies.
+- Otherwise, splits the full input into commands with tmp_buf_reader().
 Returns:
 - 1 on successful processing.
 - 0 on failure (e.g., syntax error, file I/O error).
@@ -69,41 +69,25 @@ int	proc_first_line(char *input, char *first_line_end, t_vars *vars)
 /*
 Processes the heredoc path in multiline input.
 - Validates heredoc syntax.
-- Sets up temporary buffer for heredoc content.
-- Processes content from buffer and interactive input.
-- Executes command with heredoc input.
+- Hands the lines after the command to gather_heredocs() through
+  vars->hd_src, heredoc bodies are taken from there in order.
+- Executes the first line as the command.
 Returns:
-- Result from heredoc processing (1 on success, 0 on error).
+- 1 on success, 0 on error.
 Works with process_multiline_input for heredoc branch.
 */
 int	process_heredoc_path(char *input, char *first_line_end,
 			char *content_start, t_vars *vars)
 {
-	int	write_fd;
-	int	found_in_buf;
-	int	status;
 	int	first_line_len;
 
 	first_line_len = first_line_end - input;
-	status = chk_hd_first_line(input, first_line_len, vars);
-	if (!status)
-		return (0);
-	write_fd = open_hd_tmp_buf(vars);
-	if (write_fd == -1)
-		return (0);
-	found_in_buf = proc_hd_buffer(write_fd, content_start, vars);
-	if (found_in_buf == -1)
-	{
-		cleanup_heredoc_fd(write_fd);
+	if (!chk_hd_first_line(input, first_line_len, vars))
 		return (0);
-	}
-	status = handle_interactive_hd(write_fd, found_in_buf, vars);
-	if (status == -1)
-	{
-		cleanup_heredoc_fd(write_fd);
-		return (0);
-	}
-	return (hd_proc_end(write_fd, input, first_line_end, vars));
+	vars->hd_src = content_start;
+	exec_first_line(input, first_line_end, vars);
+	vars->hd_src = NULL;
+	return (1);
 }
 
 /*
@@ -118,16 +102,3 @@ void	exec_first_line(char *input, char *nl_ptr, t_vars *vars)
 	process_command(input, vars);
 	*nl_ptr = original_char;
 }
-
-/*
-Finalizes heredoc processing: closes FD, sets ready flag, executes command.
-Returns:
-- 1 (Successful heredoc processing).
-*/
-int	hd_proc_end(int write_fd, char *input, char *nl_ptr, t_vars *vars)
-{
-	close(write_fd);
-	vars->hd_text_ready = 1;
-	exec_first_line(input, nl_ptr, vars);
-	return (1);
-}
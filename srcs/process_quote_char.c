@@ -17,6 +17,7 @@ Master control function for processing quoted text in shell input.
 This function controls the complete handling of quoted strings:
  - Extracts content from between quotes (single or double).
  - Handles variable expansion for double-quoted text.
+ - Turns a "$@" word into one word per argument, see make_pos_tokens().
  - Creates appropriate token structures based on context.
  - Processes special cases like redirection targets (">file.txt").
  - Manages token adjacency and merging.
@@ -37,6 +38,9 @@ int	process_quote_char(char *input, t_vars *vars, int redir_tgt_flag)
 	if (!extract_quoted_strs(input, vars,
 			&content, &quote_type))
 		return (0);
+	if (quote_type == TYPE_DOUBLE_QUOTE && !redir_tgt_flag
+		&& !ft_strcmp(content, "$@") && is_pos_words(input, "@", vars))
+		return (make_pos_tokens(vars, content));
 	result_status = handle_empty_quote(input, vars,
 			content, quote_type);
 	if (result_status == 1)
@@ -18,7 +18,8 @@ void	store_single_redir_node(t_node *redir_node, t_node *cmd_node,
 	redir_node->redir = cmd_node;
 	redir_node->left = cmd_node;
 	if (redir_node->type == TYPE_IN_REDIR
-		|| redir_node->type == TYPE_HEREDOC)
+		|| redir_node->type == TYPE_HEREDOC
+		|| redir_node->type == TYPE_HERESTRING)
 		vars->pipes->last_in_redir = redir_node;
 	else if (redir_node->type == TYPE_OUT_REDIR
 		|| redir_node->type == TYPE_APPD_REDIR)
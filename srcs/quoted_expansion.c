@@ -18,6 +18,8 @@ Takes a string that may contain $VAR and expands them
 Handles:
  - Character-by-character processing.
  - Variable expansion.
+ - Everything is appended to one growing buffer, so the cost is
+   linear in the size of the result.
 Returns:
  - A newly allocated string with variables expanded.
  - NULL on error.
@@ -27,65 +29,60 @@ Works with process_quote_char().
 */
 char	*expand_quoted_str(char *content, t_vars *vars)
 {
-	char	*expanded;
-	int		pos;
+	t_strbuf	expanded;
+	int			pos;
+	int			appended;
 
-	pos = 0;
-	expanded = ft_strdup("");
-	if (!expanded)
+	if (!ft_sb_init(&expanded, ft_strlen(content) + 1))
 		return (NULL);
+	pos = 0;
 	while (content[pos])
 	{
 		if (content[pos] == '$')
-		{
-			expanded = expand_quoted_var(expanded, content, &pos, vars);
-			if (!expanded)
-				return (NULL);
-		}
+			appended = expand_quoted_var(&expanded, content, &pos, vars);
 		else
+			appended = append_basic_strs(&expanded, content, &pos);
+		if (!appended)
 		{
-			expanded = append_basic_strs(expanded, content, &pos);
-			if (!expanded)
-				return (NULL);
+			ft_sb_free(&expanded);
+			return (NULL);
 		}
 	}
-	return (expanded);
+	return (ft_sb_take(&expanded));
 }
 
 /*
-Expands a variable and appends it to the result string
+Expands a variable and appends it to the result buffer
 Return :
- - Updated result string.
- - Original string unchanged if variable expansion fails.
- - NULL on error.
+ - 1 on success, including when the variable does not expand
+   (the buffer is left unchanged).
+ - 0 on allocation failure.
 Works with expand_quoted_str().
 */
-char	*expand_quoted_var(char *expanded, char *content, int *pos,
+int	expand_quoted_var(t_strbuf *expanded, char *content, int *pos,
 			t_vars *vars)
 {
 	char	*var_value;
-	char	*temp;
+	int		appended;
 
 	var_value = expand_variable(content, pos, NULL, vars);
 	if (!var_value)
-		return (expanded);
-	temp = ft_strjoin(expanded, var_value);
-	ft_safefree((void **)&expanded);
+		return (1);
+	appended = ft_sb_append(expanded, var_value, ft_strlen(var_value));
 	ft_safefree((void **)&var_value);
-	if (!temp)
-		return (NULL);
-	return (temp);
+	return (appended);
 }
 
 /*
-Appends non-variable text to the expanded result string
+Appends non-variable text to the expanded result buffer
 Processes characters until a $ variable marker is found
+and copies that span straight from content.
 Return:
- - Updated result string.
- - NULL on error.
+ - 1 on success.
+ - 0 on error or if there was no text to append.
 Works with expand_quoted_str().
 */
-char	*append_basic_strs(char *expanded, char *content, int *pos)
+int	append_basic_strs(t_strbuf *expanded, char *content, int *pos)
 {
 	int	start;
 
@@ -93,35 +90,6 @@ char	*append_basic_strs(char *expanded, char *content, int *pos)
 	while (content[*pos] && content[*pos] != '$')
 		(*pos)++;
 	if (*pos > start)
-		return (append_substr(expanded, content, start, *pos - start));
-	return (NULL);
-}
-
-/*
-Appends a substring to an existing string.
-Handles:
- - Memory allocation for substring extraction.
- - String joining with proper cleanup.
-Returns:
- - New concatenated string (caller must free).
- - NULL on error
-Works with append_basic_strs().
-*/
-char	*append_substr(char *dest, char *src, int start, int len)
-{
-	char	*chunk;
-	char	*result;
-
-	if (!dest || !src)
-		return (NULL);
-	chunk = ft_substr(src, start, len);
-	if (!chunk)
-	{
-		ft_safefree((void **)&dest);
-		return (NULL);
-	}
-	result = ft_strjoin(dest, chunk);
-	ft_safefree((void **)&dest);
-	ft_safefree((void **)&chunk);
-	return (result);
+		return (ft_sb_append(expanded, content + start, *pos - start));
+	return (0);
 }
@@ -66,9 +66,9 @@ int	validate_quotes(char *input, t_vars *vars)
 Prompts for additional input based on the quote type
 Returns: 
 - Newly allocated string with the input.
-- NULL if readline fails.
+- NULL at end of input.
 */
-char	*quote_prompt(char quote_type)
+char	*quote_prompt(char quote_type, t_vars *vars)
 {
 	char	*prompt;
 	char	*addon_input;
@@ -77,10 +77,29 @@ char	*quote_prompt(char quote_type)
 		prompt = "SQUOTE> ";
 	else
 		prompt = "DQUOTE> ";
-	addon_input = readline(prompt);
+	addon_input = input_line(vars, prompt);
 	if (!addon_input)
 		return (NULL);
-	if (*addon_input)
+	if (*addon_input && vars->interactive)
 		add_history(addon_input);
 	return (addon_input);
 }
+
+/*
+Reports input that ended inside a quote.
+- Prints the same message as bash and sets the syntax error status,
+  so a -c string, a script or piped input that ends in an open quote
+  exits with 2 instead of dropping the command silently.
+Works with fix_open_quotes().
+*/
+void	quote_eof_error(char quote_type, t_vars *vars)
+{
+	char	quote[2];
+
+	quote[0] = quote_type;
+	quote[1] = '\0';
+	ft_putstr_fd("bleshell: unexpected EOF while looking for matching `", 2);
+	ft_putstr_fd(quote, 2);
+	ft_putendl_fd("'", 2);
+	vars->error_code = ERR_SYNTAX;
+}
@@ -45,6 +45,8 @@ t_node	*get_next_redir(t_node *current, t_node *cmd)
 /*
 Handles creation of a redirection token and its filename.
 Creates the redirection node and extracts the filename.
+A here-string without a word is a syntax error, like a heredoc
+without a delimiter.
 */
 int	handle_redirection_token(char *input, int *i, t_vars *vars,
 	t_tokentype type)
@@ -53,14 +55,11 @@ int	handle_redirection_token(char *input, int *i, t_vars *vars,
 	t_node	*redir_node;
 	int		moves;
 
-	if (type == TYPE_HEREDOC || type == TYPE_APPD_REDIR)
-		moves = 2;
-	else
-		moves = 1;
+	get_token_at(input, *i, &moves);
 	redir_str = ft_substr(input, *i, moves);
 	if (!redir_str)
 		return (0);
-	redir_node = initnode(type, redir_str);
+	redir_node = initnode(type, redir_str, vars);
 	ft_safefree((void **)&redir_str);
 	if (!redir_node)
 		return (0);
@@ -68,6 +67,8 @@ int	handle_redirection_token(char *input, int *i, t_vars *vars,
 	if (!proc_redir_filename(input, i, redir_node))
 	{
 		free_token_node(redir_node);
+		if (type == TYPE_HERESTRING)
+			tok_syntax_error_msg("newline", vars);
 		return (0);
 	}
 	build_token_linklist(vars, redir_node);
@@ -118,6 +119,7 @@ char	*parse_and_get_filename(char *input, int *i_ptr, int tgt_start,
 Processes and sets a redirection target filename.
 - Skips leading whitespace to find filename start
 - Calls parse_and_get_filename to extract the actual string
+- A here-string keeps its quotes, see get_herestring_word()
 - Handles memory management of existing filenames
 - Stores extracted filename in redirection node's args array
 Returns:
@@ -136,7 +138,11 @@ int	proc_redir_filename(char *input, int *i, t_node *redir_node)
 	if (!input[*i])
 		return (0);
 	tgt_start = *i;
-	filename_str = parse_and_get_filename(input, i, tgt_start, &quo_char);
+	if (redir_node->type == TYPE_HERESTRING)
+		filename_str = get_herestring_word(input, i);
+	else
+		filename_str = parse_and_get_filename(input, i, tgt_start,
+				&quo_char);
 	if (!filename_str)
 		return (0);
 	if (redir_node->args[0])
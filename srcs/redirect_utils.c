@@ -22,13 +22,14 @@ Returns:
 Works with process_redirections() and other redirection handlers.
 
 Example: When processing token list
-- Returns 1 for tokens of type <, >, >>, or <<
+- Returns 1 for tokens of type <, >, >>, << or <<<
 - Returns 0 for command, pipe, or other token types
 */
 int	is_redirection(t_tokentype type)
 {
 	if (type == TYPE_HEREDOC || type == TYPE_IN_REDIR
-		|| type == TYPE_OUT_REDIR || type == TYPE_APPD_REDIR)
+		|| type == TYPE_OUT_REDIR || type == TYPE_APPD_REDIR
+		|| type == TYPE_HERESTRING)
 		return (1);
 	else
 		return (0);
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/07/02 09:34:18 by bleow             #+#    #+#             */
+/*   Updated: 2025/07/02 14:20:41 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Reports a script that cannot be run and exits the shell.
+- Prints "bleshell: <path>: <reason>" like bash.
+- Exits with 127 for a missing or unreadable file, 126 for a directory.
+*/
+static void	script_error(char *path, int err, int code, t_vars *vars)
+{
+	ft_putstr_fd("bleshell: ", STDERR_FILENO);
+	ft_putstr_fd(path, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putendl_fd(strerror(err), STDERR_FILENO);
+	cleanup_exit(vars);
+	exit(code);
+}
+
+/*
+Opens the script given on the command line as the shell's input.
+- A non-empty regular file is mapped whole, so its lines are found
+  and copied without a read() per block.
+- Pipes, FIFOs and empty files are streamed through vars->in_rd.
+- Never returns when the script cannot be opened.
+Works with init_input().
+*/
+void	open_script(char *path, t_vars *vars)
+{
+	int			fd;
+	struct stat	st;
+	char		*map;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1 || fstat(fd, &st) == -1)
+		script_error(path, errno, 127, vars);
+	if (S_ISDIR(st.st_mode))
+		script_error(path, EISDIR, 126, vars);
+	if (S_ISREG(st.st_mode) && st.st_size > 0)
+	{
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (map != MAP_FAILED)
+		{
+			madvise(map, st.st_size, MADV_SEQUENTIAL);
+			vars->script.map = map;
+			vars->script.len = st.st_size;
+			vars->script.mapped = 1;
+			close(fd);
+			return ;
+		}
+	}
+	if (!ft_rd_init(&vars->in_rd, fd, BUFFER_SIZE))
+		crit_error(vars);
+}
+
+/*
+Makes the string given to -c the shell's input.
+- "minishell -c cmd [name [args...]]" sets $0 to name and $1, $2...
+  to the arguments after it, as in bash.
+- The string is read like a mapped script, so it may hold several
+  lines, continuations and heredoc bodies.
+- Exits with 2 when -c has no argument.
+Returns:
+- 1 if the shell was started with -c, 0 otherwise.
+Works with init_input().
+*/
+int	open_cmd_string(int argc, char **argv, t_vars *vars)
+{
+	if (argc < 2 || ft_strcmp(argv[1], "-c") != 0)
+		return (0);
+	if (argc < 3)
+	{
+		ft_putendl_fd("bleshell: -c: option requires an argument",
+			STDERR_FILENO);
+		cleanup_exit(vars);
+		exit(2);
+	}
+	vars->script.map = argv[2];
+	vars->script.len = ft_strlen(argv[2]);
+	if (argc > 3)
+	{
+		vars->pos_args = argv + 3;
+		vars->pos_count = argc - 4;
+	}
+	return (1);
+}
+
+/*
+Takes the next line of a script held in memory.
+Returns:
+- The line without its newline, allocated.
+- NULL once the whole script was read or on allocation failure.
+Works with input_line().
+*/
+char	*script_line(t_script *script)
+{
+	char	*start;
+	char	*nl;
+	size_t	len;
+
+	if (script->pos >= script->len)
+		return (NULL);
+	start = script->map + script->pos;
+	len = script->len - script->pos;
+	nl = ft_memchr(start, '\n', len);
+	if (nl)
+		len = nl - start;
+	script->pos += len + (nl != NULL);
+	return (ft_strndup(start, len));
+}
+
+/*
+Reads one line from fd a byte at a time.
+- Used for a stdin that cannot seek back and cannot be peeked at
+  with tee(), see init_pipe_input(): commands share it with the
+  shell, so the shell never reads past the newline and the rest of
+  the input stays for the commands, as in bash.
+Returns:
+- The line without its newline, allocated.
+- NULL at end of input or on read error.
+Works with read_line_peek().
+*/
+char	*read_line_bytewise(int fd)
+{
+	t_strbuf	line;
+	ssize_t		bytes;
+	char		c;
+
+	if (!ft_sb_init(&line, FT_RD_MIN_CAP))
+		return (NULL);
+	while (1)
+	{
+		bytes = read(fd, &c, 1);
+		if (bytes == -1 && errno == EINTR)
+			continue ;
+		if (bytes <= 0 || c == '\n')
+			break ;
+		if (!ft_sb_append(&line, &c, 1))
+			bytes = -1;
+		if (bytes == -1)
+			break ;
+	}
+	if (bytes < 0 || (bytes == 0 && line.len == 0))
+	{
+		ft_sb_free(&line);
+		return (NULL);
+	}
+	return (ft_sb_take(&line));
+}
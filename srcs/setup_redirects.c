@@ -51,7 +51,7 @@ int	setup_input_redirection(char *file, t_vars *vars)
 		close(vars->pipes->redir_fd);
 		vars->pipes->redir_fd = -1;
 	}
-	vars->pipes->redir_fd = open(file, O_RDONLY);
+	vars->pipes->redir_fd = open(file, O_RDONLY | O_CLOEXEC);
 	if (vars->pipes->redir_fd == -1)
 	{
 		vars->error_code = ERR_REDIRECTION;
@@ -119,7 +119,7 @@ int	setup_output_redirection(char *file, t_vars *vars)
 		mode = O_WRONLY | O_CREAT | O_APPEND;
 	else
 		mode = O_WRONLY | O_CREAT | O_TRUNC;
-	vars->pipes->redir_fd = open(file, mode, 0666);
+	vars->pipes->redir_fd = open(file, mode | O_CLOEXEC, 0666);
 	if (vars->pipes->redir_fd == -1)
 	{
 		vars->error_code = ERR_REDIRECTION;
@@ -137,9 +137,8 @@ int	setup_output_redirection(char *file, t_vars *vars)
 
 /*
 Sets up heredoc redirection handling.
-- Checks if heredoc content is ready.
-- Initiates interactive mode if end delimiter not found.
-- Handles the actual heredoc setup via handle_heredoc().
+- The body was already read by gather_heredocs() into the node's
+  own store, so this only redirects stdin to it.
 Returns:
 - 1 on success
 - 0 on failure
@@ -149,17 +148,6 @@ int	setup_heredoc_redir(t_node *node, t_vars *vars)
 {
 	if (!node || !vars)
 		return (0);
-	if (!vars->pipes->heredoc_delim && node->right && node->right->args
-		&& node->right->args[0])
-	{
-		if (!is_valid_delim(node->right->args[0], vars))
-			return (0);
-	}
-	if (!vars->hd_text_ready)
-	{
-		if (!interactive_hd_mode(vars, g_signal_received, 0))
-			return (0);
-	}
 	if (!handle_heredoc(node, vars))
 		return (0);
 	return (1);
@@ -22,30 +22,18 @@ Return:
 */
 int	get_shell_level(t_vars *vars)
 {
-	int		i;
-	char	*shlvl_str;
-	char	*new_shlvl_str;
+	int	pos;
 
 	if (!vars || !vars->env)
 		return (1);
-	i = 0;
-	while (vars->env[i])
+	pos = env_index_find(vars, "SHLVL", 5);
+	if (pos != -1 && vars->env[pos][5] == '=')
 	{
-		if (ft_strncmp(vars->env[i], "SHLVL=", 6) == 0)
-		{
-			shlvl_str = vars->env[i] + 6;
-			vars->shell_level = ft_atoi(shlvl_str);
-			return (0);
-		}
-		i++;
+		vars->shell_level = ft_atoi(vars->env[pos] + 6);
+		return (0);
 	}
-	new_shlvl_str = ft_strdup("SHLVL=1");
-	if (!new_shlvl_str)
-		return (1);
-	vars->env[i] = new_shlvl_str;
-	vars->env[i + 1] = NULL;
 	vars->shell_level = 1;
-	return (0);
+	return (env_set(vars, "SHLVL", "1"));
 }
 
 /*
@@ -54,21 +42,17 @@ Return:
 - 0 on success.
 - 1 on failure.
 */
-int	update_shlvl_env(char **env, int position, int new_level)
+int	update_shlvl_env(t_vars *vars, int new_level)
 {
 	char	*new_shlvl;
-	char	*new_env_entry;
+	int		result;
 
 	new_shlvl = ft_itoa(new_level);
 	if (!new_shlvl)
 		return (1);
-	new_env_entry = ft_strjoin("SHLVL=", new_shlvl);
+	result = env_set(vars, "SHLVL", new_shlvl);
 	ft_safefree((void **)&new_shlvl);
-	if (!new_env_entry)
-		return (1);
-	ft_safefree((void **)&env[position]);
-	env[position] = new_env_entry;
-	return (0);
+	return (result);
 }
 
 /*
@@ -80,23 +64,8 @@ Return:
 */
 int	incr_shell_level(t_vars *vars)
 {
-	int	i;
-	int	result;
-
 	if (!vars || !vars->env)
 		return (1);
 	vars->shell_level++;
-	i = 0;
-	while (vars->env[i])
-	{
-		if (ft_strncmp(vars->env[i], "SHLVL=", 6) == 0)
-		{
-			result = update_shlvl_env(vars->env, i, vars->shell_level);
-			if (result != 0)
-				return (1);
-			return (0);
-		}
-		i++;
-	}
-	return (1);
+	return (update_shlvl_env(vars, vars->shell_level));
 }
@@ -40,19 +40,33 @@ void	sigint_handler(int sig)
 }
 
 /*
-Handles Ctrl+C (SIGINT) in heredoc child processes.
+Handles Ctrl+C (SIGINT) while a heredoc body is being read.
 - Sets global signal flag to special value (-2)
-- Used specifically in forked heredoc processes
-- Allows parent process to detect heredoc interruption
-- Doesn't manipulate terminal display (handled by parent)
-Works with interactive_hd_mode() and process_heredoc().
+- Only moves the cursor to a new line, readline is stopped
+  from hd_event_hook() outside of the signal handler.
+Works with get_interactive_hd().
 */
-void	hd_child_sigint_handler(int signo)
+void	hd_sigint_handler(int signo)
 {
 	(void)signo;
 	g_signal_received = -2;
 	write(STDOUT_FILENO, "\n", 1);
-	exit(130);
+}
+
+/*
+Readline event hook used while reading a heredoc body.
+- Readline calls it regularly while it waits for input.
+- Ends the current readline() call once Ctrl+C was received, so the
+  heredoc can be cancelled without a child process.
+Returns:
+- 0 (readline ignores the value).
+Works with get_interactive_hd().
+*/
+int	hd_event_hook(void)
+{
+	if (g_signal_received == -2)
+		rl_done = 1;
+	return (0);
 }
 
 /*
@@ -80,7 +94,7 @@ Sets up signal handlers for the shell.
 - Registers signal_handler() for SIGINT (Ctrl+C)
 - Ignores SIGQUIT (Ctrl+\) signals
 - Ensures consistent signal behavior across shell operation
-Called during shell initialization in init_shell().
+Called during shell initialization in init_input(), except for -c.
 */
 void	load_signals(void)
 {
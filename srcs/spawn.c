@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: bleow <bleow@student.42kl.edu.my>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/15 11:20:42 by bleow             #+#    #+#             */
+/*   Updated: 2025/06/15 14:03:18 by bleow            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+/*
+Maps an execve() errno value to the shell error code reported for it.
+Returns:
+- ERR_PERMISSIONS, ERR_ISDIRECTORY or ERR_CMD_NOT_FOUND.
+Works with exec_child() and spawn_cmd().
+*/
+int	exec_error_code(int err)
+{
+	if (err == EACCES)
+		return (ERR_PERMISSIONS);
+	else if (err == EISDIR)
+		return (ERR_ISDIRECTORY);
+	return (ERR_CMD_NOT_FOUND);
+}
+
+/*
+Checks whether a pipeline stage can be launched with posix_spawn().
+- Stage must be a plain command node with a command word.
+- Builtins must run inside a forked shell process.
+- Redirections are set up by the shell code in the child, so stages
+  carrying them keep the fork path.
+Returns:
+- 1 if the stage can be spawned directly.
+- 0 if it needs a forked child.
+*/
+int	can_spawn_stage(t_node *stage)
+{
+	if (!stage || stage->type != TYPE_CMD || stage->redir)
+		return (0);
+	if (!stage->args || !stage->args[0] || is_builtin(stage->args[0]))
+		return (0);
+	return (1);
+}
+
+/*
+Adds the pipe fd setup of a stage as spawn file actions.
+- io[0] is dup'ed onto STDIN and io[1] onto STDOUT.
+- The original descriptors and io[2] (the read end of the next
+  pipe) are closed in the child.
+Returns:
+- 0 on success.
+- Error number from posix_spawn_file_actions_*() on failure.
+*/
+int	add_stage_actions(posix_spawn_file_actions_t *actions, int *io)
+{
+	int	err;
+
+	err = 0;
+	if (io[0] != -1)
+		err = posix_spawn_file_actions_adddup2(actions, io[0], STDIN_FILENO);
+	if (!err && io[1] != -1)
+		err = posix_spawn_file_actions_adddup2(actions, io[1], STDOUT_FILENO);
+	if (!err && io[0] != -1)
+		err = posix_spawn_file_actions_addclose(actions, io[0]);
+	if (!err && io[1] != -1)
+		err = posix_spawn_file_actions_addclose(actions, io[1]);
+	if (!err && io[2] != -1)
+		err = posix_spawn_file_actions_addclose(actions, io[2]);
+	return (err);
+}
+
+/*
+Launches an external command with posix_spawn().
+- Avoids copying the shell's page tables the way fork() does.
+- io holds the pipe fds of a pipeline stage, or NULL when the
+  child simply inherits the shell's current STDIN/STDOUT.
+- Reports exec failures the same way exec_child() does, and sets
+  vars->error_code to the status exec_error_code() maps them to.
+Returns:
+- Process ID of the child on success.
+- (-1) if the command could not be launched.
+*/
+pid_t	spawn_cmd(char *cmd_path, char **args, int *io, t_vars *vars)
+{
+	posix_spawn_file_actions_t	actions;
+	pid_t						pid;
+	int							err;
+
+	vars->error_code = ERR_DEFAULT;
+	if (posix_spawn_file_actions_init(&actions) != 0)
+		return (-1);
+	err = 0;
+	if (io)
+		err = add_stage_actions(&actions, io);
+	if (!err)
+		err = posix_spawn(&pid, cmd_path, &actions, NULL, args,
+				get_envp(vars));
+	posix_spawn_file_actions_destroy(&actions);
+	if (err)
+	{
+		vars->error_code = exec_error_code(err);
+		shell_error(cmd_path, vars->error_code, NULL);
+		return (-1);
+	}
+	return (pid);
+}
+
+/*
+Spawns one pipeline stage directly from the shell.
+- Resolves the command path, reporting missing commands.
+- Connects the stage to in_fd and out_pipe through file actions.
+Returns:
+- Process ID of the child on success.
+- 0 if the stage could not be launched (vars->error_code holds
+  the status it would have exited with).
+Works with fork_pipe_stage().
+*/
+pid_t	spawn_pipe_stage(t_node *stage, int in_fd, int out_pipe[2],
+			t_vars *vars)
+{
+	char	*cmd_path;
+	int		io[3];
+	pid_t	pid;
+
+	cmd_path = get_cmd_path(stage, get_envp(vars), vars);
+	if (!cmd_path)
+		return (0);
+	io[0] = in_fd;
+	io[1] = out_pipe[1];
+	io[2] = out_pipe[0];
+	pid = spawn_cmd(cmd_path, stage->args, io, vars);
+	ft_safefree((void **)&cmd_path);
+	if (pid == -1)
+		return (0);
+	return (pid);
+}
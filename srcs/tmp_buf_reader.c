@@ -14,53 +14,32 @@
 
 /*
 Initializes a read buffer structure.
-- Reads content from TMP_BUF
-- Sets up processing buffer
+- Sets up the command buffer
 - Initializes tracking variables
 Returns:
 - 1 on success
-- 0 on failure (memory allocation or read error)
+- 0 on memory allocation failure
 */
 int	init_read_buf(t_read_buf *rb)
 {
 	if (!rb)
 		return (0);
-	rb->file_content = NULL;
-	rb->buffer = NULL;
-	rb->pos = 0;
-	rb->in_quotes = 0;
-	rb->quote_type = 0;
-	rb->file_content = read_tmp_buf_file(TMP_BUF);
-	if (!rb->file_content)
-		return (0);
-	rb->buffer = malloc(ft_strlen(rb->file_content) + 1);
-	if (!rb->buffer)
-	{
-		ft_safefree((void **)&rb->file_content);
-		return (0);
-	}
-	return (1);
+	ft_memset(rb, 0, sizeof(t_read_buf));
+	return (ft_sb_init(&rb->cmd, FT_SB_MIN_CAP));
 }
 
 /*
 Cleans up resources in a read buffer structure.
-- Frees allocated memory
+- Frees the command buffer
 - Resets state variables
-- Optionally removes the temporary file
 */
-void	cleanup_rd_buf(t_read_buf *rb, int remove_tmp)
+void	cleanup_rd_buf(t_read_buf *rb)
 {
 	if (!rb)
 		return ;
-	if (rb->buffer)
-		ft_safefree((void **)&rb->buffer);
-	if (rb->file_content)
-		ft_safefree((void **)&rb->file_content);
-	rb->pos = 0;
+	ft_sb_free(&rb->cmd);
 	rb->in_quotes = 0;
 	rb->quote_type = 0;
-	if (remove_tmp)
-		unlink(TMP_BUF);
 }
 
 /*
@@ -87,50 +66,49 @@ void	update_quote_state(char c, t_read_buf *rb)
 
 /*
 Processes a complete command line from the buffer.
-- Null-terminates the buffer
 - Processes non-empty commands
-- Resets buffer position
+- Empties the command buffer for the next one
 */
 void	process_buffer_command(t_read_buf *rb, t_vars *vars)
 {
-	rb->buffer[rb->pos] = '\0';
-	if (rb->pos > 0)
-		process_command(rb->buffer, vars);
-	rb->pos = 0;
+	if (rb->cmd.len > 0)
+		process_command(rb->cmd.buf, vars);
+	rb->cmd.len = 0;
+	rb->cmd.buf[0] = '\0';
 }
 
 /*
-Reads from temporary buffer file and processes each line as a command.
+Splits buffered multiline input into commands and runs each one.
+- Walks the input in place line by line, each line is copied once
+  into the command buffer
 - Preserves quotes across multiple lines
 - Converts newlines in quoted regions to spaces
 - Processes each complete command separately
-- Cleans up resources when finished
 */
-void	tmp_buf_reader(t_vars *vars)
+void	tmp_buf_reader(char *input, t_vars *vars)
 {
 	t_read_buf	rb;
-	int			i;
+	char		*nl;
+	size_t		i;
 
 	if (!init_read_buf(&rb))
 		return ;
-	i = 0;
-	while (rb.file_content[i])
+	while (*input)
 	{
-		update_quote_state(rb.file_content[i], &rb);
-		if (rb.file_content[i] == '\n')
-		{
-			if (rb.in_quotes)
-				rb.buffer[rb.pos++] = ' ';
-			else
-				process_buffer_command(&rb, vars);
-		}
+		nl = ft_strchr(input, '\n');
+		if (!nl)
+			nl = input + ft_strlen(input);
+		i = 0;
+		while (input + i < nl)
+			update_quote_state(input[i++], &rb);
+		if (!ft_sb_append(&rb.cmd, input, nl - input) || !*nl)
+			break ;
+		if (rb.in_quotes)
+			ft_sb_append(&rb.cmd, " ", 1);
 		else
-		{
-			rb.buffer[rb.pos++] = rb.file_content[i];
-		}
-		i++;
+			process_buffer_command(&rb, vars);
+		input = nl + 1;
 	}
-	if (rb.pos > 0)
-		process_buffer_command(&rb, vars);
-	cleanup_rd_buf(&rb, 1);
+	process_buffer_command(&rb, vars);
+	cleanup_rd_buf(&rb);
 }
@@ -49,7 +49,8 @@ void	tokenize_quote(char *input, t_vars *vars)
 	if (vars->prev_type == TYPE_IN_REDIR
 		|| vars->prev_type == TYPE_OUT_REDIR
 		|| vars->prev_type == TYPE_APPD_REDIR
-		|| vars->prev_type == TYPE_HEREDOC)
+		|| vars->prev_type == TYPE_HEREDOC
+		|| vars->prev_type == TYPE_HERESTRING)
 	{
 		is_redir_target = 1;
 	}
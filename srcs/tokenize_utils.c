@@ -74,7 +74,7 @@ void	handle_right_adj(char *input, t_vars *vars)
 
 	if (vars->pos <= vars->start)
 		return ;
-	adj_str = ft_substr(input, vars->start, vars->pos - vars->start);
+	adj_str = ft_strndup(input + vars->start, vars->pos - vars->start);
 	if (!adj_str)
 		return ;
 	target_token = get_valid_target_token(vars);
@@ -121,7 +121,7 @@ char	*get_delim_str(char *input, t_vars *vars, int *error_code)
 		*error_code = 1;
 		return (NULL);
 	}
-	ori_delim_str = ft_substr(input, vars->start, vars->pos - vars->start);
+	ori_delim_str = ft_strndup(input + vars->start, vars->pos - vars->start);
 	if (!ori_delim_str)
 	{
 		vars->error_code = ERR_DEFAULT;
@@ -142,7 +142,8 @@ void	handle_text(char *input, t_vars *vars)
 	token_preview = NULL;
 	if (vars->pos > vars->start)
 	{
-		token_preview = ft_substr(input, vars->start, vars->pos - vars->start);
+		token_preview = ft_strndup(input + vars->start,
+				vars->pos - vars->start);
 		set_token_type(vars, token_preview);
 		handle_string(input, vars);
 		if (token_preview)
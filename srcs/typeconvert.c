@@ -18,9 +18,7 @@ Example: TYPE_PIPE -> "|" (String representation)
 */
 char	*get_token_str(t_tokentype type)
 {
-	if (type == TYPE_ARGS)
-		return (TOKEN_TYPE_ARGS);
-	else if (type == TYPE_CMD)
+	if (type == TYPE_CMD)
 		return (TOKEN_TYPE_CMD);
 	else if (type == TYPE_DOUBLE_QUOTE)
 		return (TOKEN_TYPE_DOUBLE_QUOTE);
@@ -28,6 +26,8 @@ char	*get_token_str(t_tokentype type)
 		return (TOKEN_TYPE_SINGLE_QUOTE);
 	else if (type == TYPE_HEREDOC)
 		return (TOKEN_TYPE_HEREDOC);
+	else if (type == TYPE_HERESTRING)
+		return (TOKEN_TYPE_HERESTRING);
 	else if (type == TYPE_PIPE)
 		return (TOKEN_TYPE_PIPE);
 	else if (type == TYPE_EXPANSION)